@@ -0,0 +1,72 @@
+#include "arena.hpp"
+
+#include <cstring>
+
+namespace odbcscanner {
+
+static size_t AlignUp(size_t num) {
+	return (num + Arena::ALIGNMENT - 1) & ~(Arena::ALIGNMENT - 1);
+}
+
+void *Arena::Allocate(size_t size_bytes) {
+	if (block_idx < blocks.size()) {
+		size_t aligned_offset = AlignUp(offset);
+		if (aligned_offset + size_bytes <= blocks[block_idx].size) {
+			offset = aligned_offset + size_bytes;
+			return blocks[block_idx].data.get() + aligned_offset;
+		}
+	}
+
+	// blocks retained from the previous chunks are reused when they are large enough
+	for (size_t i = block_idx + 1; i < blocks.size(); i++) {
+		if (size_bytes <= blocks[i].size) {
+			block_idx = i;
+			offset = size_bytes;
+			return blocks[i].data.get();
+		}
+	}
+
+	size_t block_size = size_bytes > DEFAULT_BLOCK_SIZE ? AlignUp(size_bytes) : DEFAULT_BLOCK_SIZE;
+	std::unique_ptr<char[]> data(new char[block_size]);
+	blocks.emplace_back(std::move(data), block_size);
+	block_idx = blocks.size() - 1;
+	offset = size_bytes;
+	return blocks[block_idx].data.get();
+}
+
+void *Arena::Reallocate(void *ptr, size_t old_size_bytes, size_t new_size_bytes) {
+	if (ptr == nullptr) {
+		return Allocate(new_size_bytes);
+	}
+
+	char *cptr = static_cast<char *>(ptr);
+	if (block_idx < blocks.size()) {
+		Block &block = blocks[block_idx];
+		char *block_pos = block.data.get() + offset;
+		if (cptr + old_size_bytes == block_pos && offset - old_size_bytes + new_size_bytes <= block.size) {
+			offset = offset - old_size_bytes + new_size_bytes;
+			return ptr;
+		}
+	}
+
+	void *res = Allocate(new_size_bytes);
+	std::memcpy(res, ptr, old_size_bytes < new_size_bytes ? old_size_bytes : new_size_bytes);
+	return res;
+}
+
+void Arena::Reset() {
+	size_t retained = 0;
+	for (size_t i = 0; i < blocks.size(); i++) {
+		if (blocks[i].size <= MAX_RETAINED_BLOCK_SIZE) {
+			if (retained != i) {
+				blocks[retained] = std::move(blocks[i]);
+			}
+			retained++;
+		}
+	}
+	blocks.erase(blocks.begin() + static_cast<std::ptrdiff_t>(retained), blocks.end());
+	block_idx = 0;
+	offset = 0;
+}
+
+} // namespace odbcscanner
@@ -0,0 +1,264 @@
+#include "cardinality.hpp"
+
+#include <mutex>
+#include <vector>
+
+#include "odbc_api.hpp"
+#include "statement_pool.hpp"
+#include "widechar.hpp"
+
+namespace odbcscanner {
+
+namespace {
+
+// Table name split into the [catalog.][schema.]table parts,
+// quoted parts are unquoted.
+struct TableName {
+	std::string catalog;
+	std::string schema;
+	std::string table;
+	bool table_quoted = false;
+	bool schema_quoted = false;
+};
+
+enum class EstimateResult { FOUND, NOT_AVAILABLE, FAILED };
+
+} // namespace
+
+static TableName ParseTableName(const std::string &name) {
+	std::vector<std::string> parts;
+	std::vector<bool> quoted;
+	std::string current;
+	bool current_quoted = false;
+	char quote = '\0';
+	for (size_t i = 0; i < name.length(); i++) {
+		char ch = name[i];
+		if (quote != '\0') {
+			char closing = quote == '[' ? ']' : quote;
+			if (ch == closing) {
+				if (closing != ']' && i + 1 < name.length() && name[i + 1] == closing) {
+					current.push_back(ch);
+					i++;
+				} else {
+					quote = '\0';
+				}
+			} else {
+				current.push_back(ch);
+			}
+		} else if (ch == '"' || ch == '`' || ch == '[') {
+			quote = ch;
+			current_quoted = true;
+		} else if (ch == '.') {
+			parts.emplace_back(std::move(current));
+			quoted.push_back(current_quoted);
+			current = std::string();
+			current_quoted = false;
+		} else if (ch != ' ') {
+			current.push_back(ch);
+		}
+	}
+	parts.emplace_back(std::move(current));
+	quoted.push_back(current_quoted);
+
+	TableName res;
+	size_t count = parts.size();
+	res.table = parts.at(count - 1);
+	res.table_quoted = quoted.at(count - 1);
+	if (count >= 2) {
+		res.schema = parts.at(count - 2);
+		res.schema_quoted = quoted.at(count - 2);
+	}
+	if (count >= 3) {
+		res.catalog = parts.at(count - 3);
+	}
+	return res;
+}
+
+static std::string Literal(const std::string &str) {
+	std::string res = "'";
+	for (char ch : str) {
+		if (ch == '\'') {
+			res.push_back(ch);
+		}
+		res.push_back(ch);
+	}
+	res.push_back('\'');
+	return res;
+}
+
+// Oracle and DB2 store unquoted identifiers in upper case
+static std::string UpperUnquoted(const std::string &name, bool quoted) {
+	if (quoted) {
+		return name;
+	}
+	std::string res = name;
+	for (char &ch : res) {
+		if (ch >= 'a' && ch <= 'z') {
+			ch = static_cast<char>(ch - 'a' + 'A');
+		}
+	}
+	return res;
+}
+
+static std::string CatalogQuery(DbmsDriver driver, const std::string &table) {
+	TableName name = ParseTableName(table);
+	switch (driver) {
+	case DbmsDriver::MSSQL:
+		return "SELECT SUM(p.rows) FROM sys.partitions p WHERE p.object_id = OBJECT_ID(" + Literal(table) +
+		       ") AND p.index_id IN (0, 1)";
+	case DbmsDriver::POSTGRESQL:
+		return "SELECT CAST(reltuples AS BIGINT) FROM pg_class WHERE oid = to_regclass(" + Literal(table) + ")";
+	case DbmsDriver::ORACLE: {
+		std::string owner = name.schema.empty() ? "USER" : Literal(UpperUnquoted(name.schema, name.schema_quoted));
+		return "SELECT num_rows FROM all_tables WHERE owner = " + owner +
+		       " AND table_name = " + Literal(UpperUnquoted(name.table, name.table_quoted));
+	}
+	case DbmsDriver::DB2: {
+		std::string schema =
+		    name.schema.empty() ? "CURRENT SCHEMA" : Literal(UpperUnquoted(name.schema, name.schema_quoted));
+		return "SELECT card FROM syscat.tables WHERE tabschema = " + schema +
+		       " AND tabname = " + Literal(UpperUnquoted(name.table, name.table_quoted));
+	}
+	case DbmsDriver::MARIADB:
+	case DbmsDriver::MYSQL: {
+		std::string schema = name.schema.empty() ? "DATABASE()" : Literal(name.schema);
+		return "SELECT table_rows FROM information_schema.tables WHERE table_schema = " + schema +
+		       " AND table_name = " + Literal(name.table);
+	}
+	default:
+		return std::string();
+	}
+}
+
+static bool AllocStmt(OdbcConnection &conn, StmtHandlePtr &hstmt_out) {
+	SQLRETURN ret = conn.stmt_pool->Alloc(hstmt_out);
+	return SQL_SUCCEEDED(ret);
+}
+
+// Reads the BIGINT value of the specified column in the current row,
+// NULL and negative values (used for unknown statistics) are ignored.
+static EstimateResult ReadCardinality(HSTMT hstmt, SQLUSMALLINT col_idx, uint64_t &cardinality_out) {
+	int64_t value = -1;
+	SQLLEN ind = 0;
+	SQLRETURN ret = SQLGetData(hstmt, col_idx, SQL_C_SBIGINT, &value, sizeof(value), &ind);
+	if (!SQL_SUCCEEDED(ret)) {
+		return EstimateResult::FAILED;
+	}
+	if (ind == SQL_NULL_DATA || value < 0) {
+		return EstimateResult::NOT_AVAILABLE;
+	}
+	cardinality_out = static_cast<uint64_t>(value);
+	return EstimateResult::FOUND;
+}
+
+// Failed statement aborts the open transaction on some DBMSes (PostgreSQL). Drivers
+// may implement 'SQLStatistics' with catalog queries on the same connection too
+// (psqlODBC), so both lookups are only run on the connections in autocommit mode.
+static bool IsAutocommit(OdbcConnection &conn) {
+	SQLUINTEGER autocommit = SQL_AUTOCOMMIT_OFF;
+	SQLRETURN ret = SQLGetConnectAttr(conn.dbc, SQL_ATTR_AUTOCOMMIT, &autocommit, 0, nullptr);
+	return SQL_SUCCEEDED(ret) && autocommit == SQL_AUTOCOMMIT_ON;
+}
+
+static EstimateResult EstimateFromCatalog(OdbcConnection &conn, const std::string &query, uint64_t &cardinality_out) {
+	StmtHandlePtr hstmt(nullptr, StmtHandleDeleter());
+	if (!AllocStmt(conn, hstmt)) {
+		return EstimateResult::FAILED;
+	}
+	auto wquery = WideChar::Widen(query.data(), query.length());
+	SQLRETURN ret = SQLExecDirectW(hstmt.get(), wquery.data(), wquery.length<SQLINTEGER>());
+	if (!SQL_SUCCEEDED(ret)) {
+		return EstimateResult::FAILED;
+	}
+	ret = SQLFetch(hstmt.get());
+	if (ret == SQL_NO_DATA) {
+		return EstimateResult::NOT_AVAILABLE;
+	}
+	if (!SQL_SUCCEEDED(ret)) {
+		return EstimateResult::FAILED;
+	}
+	return ReadCardinality(hstmt.get(), 1, cardinality_out);
+}
+
+static EstimateResult EstimateFromStatistics(OdbcConnection &conn, const std::string &table,
+                                             uint64_t &cardinality_out) {
+	StmtHandlePtr hstmt(nullptr, StmtHandleDeleter());
+	if (!AllocStmt(conn, hstmt)) {
+		return EstimateResult::FAILED;
+	}
+	TableName name = ParseTableName(table);
+	auto wcatalog = WideChar::Widen(name.catalog.data(), name.catalog.length());
+	auto wschema = WideChar::Widen(name.schema.data(), name.schema.length());
+	auto wtable = WideChar::Widen(name.table.data(), name.table.length());
+	SQLRETURN ret = SQLStatisticsW(hstmt.get(), name.catalog.empty() ? nullptr : wcatalog.data(),
+	                               wcatalog.length<SQLSMALLINT>(), name.schema.empty() ? nullptr : wschema.data(),
+	                               wschema.length<SQLSMALLINT>(), wtable.data(), wtable.length<SQLSMALLINT>(),
+	                               SQL_INDEX_ALL, SQL_QUICK);
+	if (!SQL_SUCCEEDED(ret)) {
+		return EstimateResult::FAILED;
+	}
+
+	// table statistics row has TYPE (column 7) set to SQL_TABLE_STAT,
+	// the number of rows is returned in CARDINALITY (column 11)
+	for (;;) {
+		ret = SQLFetch(hstmt.get());
+		if (ret == SQL_NO_DATA) {
+			return EstimateResult::NOT_AVAILABLE;
+		}
+		if (!SQL_SUCCEEDED(ret)) {
+			return EstimateResult::FAILED;
+		}
+		SQLSMALLINT type = -1;
+		SQLLEN ind = 0;
+		ret = SQLGetData(hstmt.get(), 7, SQL_C_SSHORT, &type, sizeof(type), &ind);
+		if (!SQL_SUCCEEDED(ret)) {
+			return EstimateResult::FAILED;
+		}
+		if (ind != SQL_NULL_DATA && type == SQL_TABLE_STAT) {
+			return ReadCardinality(hstmt.get(), 11, cardinality_out);
+		}
+	}
+}
+
+bool Cardinality::Estimate(OdbcConnection &conn, const std::string &table, uint64_t &cardinality_out) {
+	{
+		std::lock_guard<std::mutex> guard(conn.cardinality_mutex);
+		auto it = conn.cardinality_cache.find(table);
+		if (it != conn.cardinality_cache.end()) {
+			if (it->second < 0) {
+				return false;
+			}
+			cardinality_out = static_cast<uint64_t>(it->second);
+			return true;
+		}
+	}
+
+	// estimate is not cached, it is looked up by a later call outside of the transaction
+	if (!IsAutocommit(conn)) {
+		return false;
+	}
+
+	// 'SQLStatistics' is tried first, the catalog query is the fallback for the known drivers
+	uint64_t cardinality = 0;
+	EstimateResult res = EstimateFromStatistics(conn, table, cardinality);
+	if (res != EstimateResult::FOUND) {
+		std::string query = CatalogQuery(conn.driver, table);
+		if (!query.empty()) {
+			res = EstimateFromCatalog(conn, query, cardinality);
+		}
+	}
+
+	// unavailable estimates are cached to not repeat the lookups, failed
+	// lookups are not cached, they are retried on the next call
+	if (res != EstimateResult::FAILED) {
+		std::lock_guard<std::mutex> guard(conn.cardinality_mutex);
+		conn.cardinality_cache[table] = res == EstimateResult::FOUND ? static_cast<int64_t>(cardinality) : -1;
+	}
+	if (res == EstimateResult::FOUND) {
+		cardinality_out = cardinality;
+		return true;
+	}
+	return false;
+}
+
+} // namespace odbcscanner
@@ -100,8 +100,43 @@ static OdbcType GetTypeAttributes(const std::string &query, SQLSMALLINT cols_cou
 		}
 	}
 
+	SQLLEN desc_length = 0;
+	SQLLEN desc_octet_length = 0;
+	if (Types::IsCharacterSQLType(static_cast<SQLSMALLINT>(desc_concise_type))) {
+		{
+			SQLRETURN ret = SQLColAttributeW(hstmt, col_idx, SQL_DESC_LENGTH, nullptr, 0, nullptr, &desc_length);
+			if (!SQL_SUCCEEDED(ret)) {
+				std::string diag = Diagnostics::Read(hstmt, SQL_HANDLE_STMT);
+				throw ScannerException(
+				    "'SQLColAttribute' for SQL_DESC_LENGTH failed, column index: " + std::to_string(col_idx) +
+				    ", columns count: " + std::to_string(cols_count) + ", query: '" + query +
+				    "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+			}
+		}
+
+		{
+			SQLRETURN ret =
+			    SQLColAttributeW(hstmt, col_idx, SQL_DESC_OCTET_LENGTH, nullptr, 0, nullptr, &desc_octet_length);
+			if (!SQL_SUCCEEDED(ret)) {
+				std::string diag = Diagnostics::Read(hstmt, SQL_HANDLE_STMT);
+				throw ScannerException(
+				    "'SQLColAttribute' for SQL_DESC_OCTET_LENGTH failed, column index: " + std::to_string(col_idx) +
+				    ", columns count: " + std::to_string(cols_count) + ", query: '" + query +
+				    "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+			}
+		}
+
+		// unlimited lengths are reported as 0 or as negative values by some drivers
+		if (desc_length < 0) {
+			desc_length = 0;
+		}
+		if (desc_octet_length < 0) {
+			desc_octet_length = 0;
+		}
+	}
+
 	return OdbcType(desc_type, desc_concise_type, is_unsigned == SQL_TRUE, std::move(desc_type_name), decimal_precision,
-	                decimal_scale);
+	                decimal_scale, desc_length, desc_octet_length);
 }
 
 std::vector<ResultColumn> Columns::Collect(QueryContext &ctx) {
@@ -172,6 +207,15 @@ void Columns::CheckSame(QueryContext &ctx, std::vector<ResultColumn> &expected,
 	}
 }
 
+std::vector<ResultColumn> Columns::Clone(const std::vector<ResultColumn> &columns) {
+	std::vector<ResultColumn> res;
+	res.reserve(columns.size());
+	for (const ResultColumn &col : columns) {
+		res.emplace_back(col.Clone());
+	}
+	return res;
+}
+
 void Columns::AddToResults(duckdb_bind_info info, duckdb_type type_id, ResultColumn &col) {
 	if (type_id == DUCKDB_TYPE_DECIMAL) {
 		auto ltype =
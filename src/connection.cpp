@@ -1,18 +1,27 @@
 #include "connection.hpp"
 
 #include <cstdint>
+#include <cstdlib>
+#include <mutex>
 #include <regex>
 #include <vector>
 
 #include "capi_pointers.hpp"
+#include "connection_pool.hpp"
+#include "connection_scheduler.hpp"
 #include "diagnostics.hpp"
 #include "make_unique.hpp"
 #include "registries.hpp"
 #include "scanner_exception.hpp"
+#include "statement_cache.hpp"
+#include "statement_pool.hpp"
+#include "strings.hpp"
 #include "widechar.hpp"
 
 namespace odbcscanner {
 
+static const std::string ODBCSCANNER_DEBUG_CONN_STRING_ENV_VAR = "ODBCSCANNER_DEBUG_CONN_STRING_ENV_VAR";
+
 static DbmsDriver ResolveDbmsDriver(const std::string &dbms_name, const std::string &driver_name) {
 	if (dbms_name == "Oracle") {
 		return DbmsDriver::ORACLE;
@@ -51,7 +60,8 @@ static std::string FilterPwd(const std::string url) {
 	return std::regex_replace(uid_filtered, pwd_pattern, "PWD=***");
 }
 
-OdbcConnection::OdbcConnection(const std::string &url) {
+static SQLHANDLE AllocEnv() {
+	SQLHANDLE env = nullptr;
 	{
 		SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_ENV, nullptr, &env);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -64,11 +74,92 @@ OdbcConnection::OdbcConnection(const std::string &url) {
 		                              reinterpret_cast<SQLPOINTER>(static_cast<uintptr_t>(SQL_OV_ODBC3)), 0);
 		if (!SQL_SUCCEEDED(ret)) {
 			std::string diag = Diagnostics::Read(env, SQL_HANDLE_ENV);
+			SQLFreeHandle(SQL_HANDLE_ENV, env);
 			throw ScannerException("'SQLSetEnvAttr' failed, return: " + std::to_string(ret) + ", diagnostics: '" +
 			                       diag + "'");
 		}
 	}
 
+	return env;
+}
+
+// Allocated once for all the connections, like the connections
+// registry, it is not freed on process exit
+static SQLHANDLE SharedEnv() {
+	static SQLHANDLE env = AllocEnv();
+	return env;
+}
+
+struct DriverInfo {
+	DbmsDriver driver = DbmsDriver::GENERIC;
+	// 0 when the number of active statements is not limited
+	uint32_t max_active_statements = 1;
+	bool getdata_in_bound_rowset = false;
+};
+
+// DBMS and driver names are only read once for every connection string
+struct DriversCache {
+	std::mutex mutex;
+	std::map<std::string, DriverInfo> drivers;
+};
+
+static DriversCache &SharedDriversCache() {
+	static DriversCache *cache = new DriversCache();
+	return *cache;
+}
+
+static bool FindCachedDriver(const std::string &url, DriverInfo &driver_out) {
+	DriversCache &cache = SharedDriversCache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	auto it = cache.drivers.find(url);
+	if (it == cache.drivers.end()) {
+		return false;
+	}
+	driver_out = it->second;
+	return true;
+}
+
+static void CacheDriver(const std::string &url, const DriverInfo &driver) {
+	DriversCache &cache = SharedDriversCache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	cache.drivers[url] = driver;
+}
+
+// MSSQL reports a single active statement even when MARS is enabled for the connection
+static const SQLINTEGER SQL_COPT_SS_MARS_ENABLED = 1224;
+static const SQLULEN SQL_MARS_ENABLED_YES = 1;
+
+static uint32_t ReadMaxActiveStatements(SQLHDBC dbc, DbmsDriver driver) {
+	if (driver == DbmsDriver::MSSQL) {
+		SQLULEN mars = 0;
+		SQLRETURN ret = SQLGetConnectAttr(dbc, SQL_COPT_SS_MARS_ENABLED, &mars, 0, nullptr);
+		if (SQL_SUCCEEDED(ret) && mars == SQL_MARS_ENABLED_YES) {
+			return 0;
+		}
+	}
+	SQLUSMALLINT max_activities = 1;
+	SQLRETURN ret = SQLGetInfo(dbc, SQL_MAX_CONCURRENT_ACTIVITIES, &max_activities, sizeof(max_activities), nullptr);
+	// 0 means that the limit is either absent or unknown, calls are serialized
+	// unless the driver is known to allow concurrent statements (MSSQL with MARS)
+	if (!SQL_SUCCEEDED(ret) || max_activities == 0) {
+		return 1;
+	}
+	return max_activities;
+}
+
+static bool ReadGetDataInBoundRowset(SQLHDBC dbc) {
+	SQLUINTEGER getdata_ext = 0;
+	SQLRETURN ret = SQLGetInfo(dbc, SQL_GETDATA_EXTENSIONS, &getdata_ext, sizeof(getdata_ext), nullptr);
+	if (!SQL_SUCCEEDED(ret) || (getdata_ext & SQL_GD_BOUND) == 0 || (getdata_ext & SQL_GD_BLOCK) == 0) {
+		return false;
+	}
+	SQLUINTEGER pos_ops = 0;
+	ret = SQLGetInfo(dbc, SQL_POS_OPERATIONS, &pos_ops, sizeof(pos_ops), nullptr);
+	return SQL_SUCCEEDED(ret) && (pos_ops & SQL_POS_POSITION) != 0;
+}
+
+OdbcConnection::OdbcConnection(const std::string &url_in)
+    : env(SharedEnv()), url(url_in), stmt_cache(std_make_unique<StatementCache>()) {
 	{
 		SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_DBC, env, &dbc);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -82,11 +173,22 @@ OdbcConnection::OdbcConnection(const std::string &url) {
 		                                  SQL_DRIVER_NOPROMPT);
 		if (!SQL_SUCCEEDED(ret)) {
 			std::string diag = Diagnostics::Read(dbc, SQL_HANDLE_DBC);
+			SQLFreeHandle(SQL_HANDLE_DBC, dbc);
 			throw ScannerException("'SQLDriverConnect' failed, connection string: '" + FilterPwd(url) +
 			                       "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
 		}
 	}
 
+	this->stmt_pool = std::make_shared<StatementPool>(dbc);
+
+	DriverInfo info;
+	if (FindCachedDriver(url, info)) {
+		this->driver = info.driver;
+		this->getdata_in_bound_rowset = info.getdata_in_bound_rowset;
+		this->scheduler = std_make_unique<ConnectionScheduler>(info.max_active_statements);
+		return;
+	}
+
 	std::string dbms_name;
 	{
 		std::vector<char> buf;
@@ -115,13 +217,23 @@ OdbcConnection::OdbcConnection(const std::string &url) {
 		driver_name = std::string(buf.data(), len);
 	}
 
-	this->driver = ResolveDbmsDriver(dbms_name, driver_name);
+	info.driver = ResolveDbmsDriver(dbms_name, driver_name);
+	info.max_active_statements = ReadMaxActiveStatements(dbc, info.driver);
+	info.getdata_in_bound_rowset = ReadGetDataInBoundRowset(dbc);
+	CacheDriver(url, info);
+
+	this->driver = info.driver;
+	this->getdata_in_bound_rowset = info.getdata_in_bound_rowset;
+	this->scheduler = std_make_unique<ConnectionScheduler>(info.max_active_statements);
 }
 
 OdbcConnection::~OdbcConnection() noexcept {
+	// cached and idle statements must be freed before disconnecting,
+	// statements that are still in use are freed by the driver
+	stmt_cache.reset();
+	stmt_pool->Close();
 	SQLDisconnect(dbc);
 	SQLFreeHandle(SQL_HANDLE_DBC, dbc);
-	SQLFreeHandle(SQL_HANDLE_ENV, env);
 }
 
 ExtractedConnection OdbcConnection::ExtractOrOpen(const std::string &function_name, duckdb_value conn_id_or_str_val) {
@@ -140,7 +252,7 @@ ExtractedConnection OdbcConnection::ExtractOrOpen(const std::string &function_na
 			throw ScannerException("'" + function_name + "' error: extracted ODBC connection must be not NULL");
 		}
 		std::string conn_str(conn_cstr.get());
-		auto oc_ptr = std_make_unique<OdbcConnection>(conn_str);
+		auto oc_ptr = ConnectionPool::Acquire(conn_str);
 		conn_id = ConnectionsRegistry::Add(std::move(oc_ptr));
 		must_be_closed = true;
 	} else if (type_id == DUCKDB_TYPE_BIGINT) {
@@ -153,8 +265,8 @@ ExtractedConnection OdbcConnection::ExtractOrOpen(const std::string &function_na
 		                       " or an ODBC connection string (for one-off queries)");
 	}
 
-	auto conn_ptr = ConnectionsRegistry::Remove(conn_id);
-	if (conn_ptr.get() == nullptr) {
+	auto conn_ptr = ConnectionsRegistry::Lease(conn_id);
+	if (!conn_ptr) {
 		throw ScannerException("'" + function_name +
 		                       "' error: ODBC connection not found on bind, id: " + std::to_string(conn_id));
 	}
@@ -162,4 +274,18 @@ ExtractedConnection OdbcConnection::ExtractOrOpen(const std::string &function_na
 	return ExtractedConnection(conn_id, std::move(conn_ptr), must_be_closed);
 }
 
+std::string OdbcConnection::ResolveDebugConnString(const std::string &conn_str) {
+	// Env var fetch is not thread-safe, should be used only for debugging,
+	// ideally this logic should be moved into SQLLogic test runner.
+	if (conn_str.rfind(ODBCSCANNER_DEBUG_CONN_STRING_ENV_VAR, 0) == 0 && conn_str.find(";") == std::string::npos) {
+		std::vector<std::string> parts = Strings::Split(conn_str, '=');
+		if (parts.size() == 2 && ODBCSCANNER_DEBUG_CONN_STRING_ENV_VAR == parts.at(0)) {
+			std::string &var_name = parts.at(1);
+			char *var = std::getenv(var_name.c_str());
+			return var != nullptr ? std::string(var) : "Driver={DuckDB Driver};";
+		}
+	}
+	return conn_str;
+}
+
 } // namespace odbcscanner
@@ -0,0 +1,172 @@
+#include "connection_pool.hpp"
+
+#include <chrono>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "make_unique.hpp"
+
+namespace odbcscanner {
+
+namespace {
+
+struct IdleConnection {
+	std::unique_ptr<OdbcConnection> conn_ptr;
+	std::chrono::steady_clock::time_point released_at;
+
+	IdleConnection(std::unique_ptr<OdbcConnection> conn_ptr_in, std::chrono::steady_clock::time_point released_at_in)
+	    : conn_ptr(std::move(conn_ptr_in)), released_at(released_at_in) {
+	}
+};
+
+// Like the connections registry, the idle connections are not closed on process exit
+struct PoolState {
+	std::mutex mutex;
+	// most recently released connection first
+	std::map<std::string, std::list<IdleConnection>> idle;
+
+	// Takes out the connections idle for longer than the timeout, they
+	// are closed by the caller after the lock is released
+	void EvictExpired(std::chrono::steady_clock::time_point now,
+	                  std::vector<std::unique_ptr<OdbcConnection>> &evicted) {
+		auto timeout = std::chrono::seconds(ConnectionPool::IDLE_TIMEOUT_SECONDS);
+		for (auto it = idle.begin(); it != idle.end();) {
+			std::list<IdleConnection> &conns = it->second;
+			while (conns.size() > ConnectionPool::MIN_IDLE_CONNECTIONS && now - conns.back().released_at > timeout) {
+				evicted.emplace_back(std::move(conns.back().conn_ptr));
+				conns.pop_back();
+			}
+			if (conns.empty()) {
+				it = idle.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+};
+
+} // namespace
+
+static PoolState &SharedPoolState() {
+	static PoolState *state = new PoolState();
+	return *state;
+}
+
+// Only the leading and trailing spaces and separators are removed, the
+// attributes may be case-sensitive and their values may contain spaces
+static std::string NormalizeKey(const std::string &url) {
+	const std::string trimmed_chars = " \t\r\n;";
+	size_t start = url.find_first_not_of(trimmed_chars);
+	if (start == std::string::npos) {
+		return std::string();
+	}
+	size_t end = url.find_last_not_of(trimmed_chars);
+	return url.substr(start, end - start + 1);
+}
+
+// ODBC 3.8 connection attribute, is not defined in the older driver manager headers
+static const SQLINTEGER ATTR_RESET_CONNECTION = 116;
+static const SQLULEN RESET_CONNECTION_YES = 1;
+
+// The session state left by the previous call (open transaction, session variables, temporary tables)
+// must not be visible to the next call. Connections are kept idle only when the driver supports the
+// session reset, or when the call allowed to keep the session, other connections are closed on release.
+static bool ResetSession(OdbcConnection &conn) {
+	SQLUINTEGER autocommit = SQL_AUTOCOMMIT_ON;
+	SQLRETURN ret = SQLGetConnectAttr(conn.dbc, SQL_ATTR_AUTOCOMMIT, &autocommit, 0, nullptr);
+	if (!SQL_SUCCEEDED(ret)) {
+		return false;
+	}
+	if (autocommit != SQL_AUTOCOMMIT_ON) {
+		ret = SQLEndTran(SQL_HANDLE_DBC, conn.dbc, SQL_ROLLBACK);
+		if (!SQL_SUCCEEDED(ret)) {
+			return false;
+		}
+		ret = SQLSetConnectAttr(conn.dbc, SQL_ATTR_AUTOCOMMIT, reinterpret_cast<SQLPOINTER>(SQL_AUTOCOMMIT_ON), 0);
+		if (!SQL_SUCCEEDED(ret)) {
+			return false;
+		}
+	}
+	// the session is reset by the driver before the next statement is executed on it
+	ret = SQLSetConnectAttr(conn.dbc, ATTR_RESET_CONNECTION, reinterpret_cast<SQLPOINTER>(RESET_CONNECTION_YES), 0);
+	return SQL_SUCCEEDED(ret) || conn.pool_without_session_reset;
+}
+
+static bool IsDead(OdbcConnection &conn) {
+	SQLUINTEGER dead = SQL_CD_FALSE;
+	SQLRETURN ret = SQLGetConnectAttr(conn.dbc, SQL_ATTR_CONNECTION_DEAD, &dead, 0, nullptr);
+	// drivers that do not support this attribute are expected to fail on the next call
+	return SQL_SUCCEEDED(ret) && dead == SQL_CD_TRUE;
+}
+
+std::unique_ptr<OdbcConnection> ConnectionPool::Acquire(const std::string &url) {
+	std::string key = NormalizeKey(url);
+	PoolState &state = SharedPoolState();
+
+	for (;;) {
+		std::unique_ptr<OdbcConnection> conn_ptr;
+		std::vector<std::unique_ptr<OdbcConnection>> evicted;
+		{
+			std::lock_guard<std::mutex> guard(state.mutex);
+			state.EvictExpired(std::chrono::steady_clock::now(), evicted);
+			auto it = state.idle.find(key);
+			if (it != state.idle.end()) {
+				conn_ptr = std::move(it->second.front().conn_ptr);
+				it->second.pop_front();
+				if (it->second.empty()) {
+					state.idle.erase(it);
+				}
+			}
+		}
+		// evicted connections are closed here without holding the lock
+		evicted.clear();
+
+		if (!conn_ptr) {
+			break;
+		}
+		if (!IsDead(*conn_ptr)) {
+			// option of the previous call does not apply to the next one
+			conn_ptr->pool_without_session_reset = false;
+			return conn_ptr;
+		}
+	}
+
+	auto conn_ptr = std_make_unique<OdbcConnection>(url);
+	conn_ptr->pool_key = std::move(key);
+	return conn_ptr;
+}
+
+void ConnectionPool::Release(std::unique_ptr<OdbcConnection> conn) noexcept {
+	if (!conn || conn->pool_key.empty()) {
+		return;
+	}
+	if (!ResetSession(*conn)) {
+		conn.reset();
+		return;
+	}
+	PoolState &state = SharedPoolState();
+	std::vector<std::unique_ptr<OdbcConnection>> evicted;
+	try {
+		std::lock_guard<std::mutex> guard(state.mutex);
+		auto now = std::chrono::steady_clock::now();
+		std::list<IdleConnection> &conns = state.idle[conn->pool_key];
+		if (conns.size() < MAX_IDLE_CONNECTIONS) {
+			conns.emplace_front(std::move(conn), now);
+		}
+		state.EvictExpired(now, evicted);
+	} catch (...) {
+		// connection is closed below if it cannot be kept idle
+	}
+	evicted.clear();
+	conn.reset();
+}
+
+void ConnectionPool::SetPoolWithoutSessionReset(OdbcConnection &conn, bool enabled) {
+	if (!conn.pool_key.empty()) {
+		conn.pool_without_session_reset = enabled;
+	}
+}
+
+} // namespace odbcscanner
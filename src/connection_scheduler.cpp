@@ -0,0 +1,48 @@
+#include "connection_scheduler.hpp"
+
+#include <chrono>
+
+namespace odbcscanner {
+
+bool ConnectionScheduler::Enter(uint32_t timeout_seconds) {
+	std::unique_lock<std::mutex> lock(mutex);
+	if (waiting.empty() && (max_active == 0 || active < max_active)) {
+		active++;
+		return true;
+	}
+
+	uint64_t ticket = ++last_ticket;
+	auto ticket_it = waiting.insert(waiting.end(), ticket);
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_seconds);
+	bool admitted = cv.wait_until(lock, deadline, [this, ticket] {
+		return waiting.front() == ticket && (max_active == 0 || active < max_active);
+	});
+	waiting.erase(ticket_it);
+	if (admitted) {
+		active++;
+	}
+	// next call in the queue may be admitted too, or it is now at the front after the timeout
+	cv.notify_all();
+	return admitted;
+}
+
+bool ConnectionScheduler::TryEnter() {
+	std::lock_guard<std::mutex> guard(mutex);
+	if (waiting.empty() && (max_active == 0 || active < max_active)) {
+		active++;
+		return true;
+	}
+	return false;
+}
+
+void ConnectionScheduler::Leave() noexcept {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		if (active > 0) {
+			active--;
+		}
+	}
+	cv.notify_all();
+}
+
+} // namespace odbcscanner
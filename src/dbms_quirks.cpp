@@ -15,6 +15,7 @@ DbmsQuirks::DbmsQuirks(OdbcConnection &conn, const std::map<std::string, ValuePt
 		this->integral_params_as_decimals = true;
 		this->timestamp_columns_with_typename_date_as_date = true;
 		this->enable_columns_binding = true;
+		this->enable_block_fetch = true;
 		break;
 	case DbmsDriver::MSSQL:
 		this->var_len_params_long_threshold_bytes = 8000;
@@ -29,6 +30,7 @@ DbmsQuirks::DbmsQuirks(OdbcConnection &conn, const std::map<std::string, ValuePt
 		this->decimal_params_as_chars = true;
 		this->decimal_columns_as_chars = true;
 		this->enable_columns_binding = true;
+		this->enable_block_fetch = true;
 		break;
 
 	case DbmsDriver::MARIADB:
@@ -47,6 +49,7 @@ DbmsQuirks::DbmsQuirks(OdbcConnection &conn, const std::map<std::string, ValuePt
 		this->decimal_columns_precision_through_ard = true;
 		this->decimal_params_as_chars = true;
 		this->timestamp_params_as_sf_timestamp_ntz = true;
+		this->varchar_columns_as_utf8_chars = true;
 		break;
 	case DbmsDriver::SPARK:
 		this->decimal_params_as_chars = true;
@@ -57,6 +60,7 @@ DbmsQuirks::DbmsQuirks(OdbcConnection &conn, const std::map<std::string, ValuePt
 		this->decimal_columns_as_chars = true;
 		this->reset_stmt_before_execute = true;
 		this->var_len_data_single_part = true;
+		this->varchar_columns_as_utf8_chars = true;
 		break;
 	case DbmsDriver::FLIGTHSQL:
 		this->decimal_columns_as_chars = true;
@@ -105,15 +109,58 @@ DbmsQuirks::DbmsQuirks(OdbcConnection &conn, const std::map<std::string, ValuePt
 			this->timestamptz_params_as_ss_timestampoffset = duckdb_get_bool(val.get());
 		} else if (en.first == "var_len_data_single_part") {
 			this->var_len_data_single_part = duckdb_get_bool(val.get());
+		} else if (en.first == "varchar_columns_as_utf8_chars") {
+			this->varchar_columns_as_utf8_chars = duckdb_get_bool(val.get());
 		} else if (en.first == "var_len_params_long_threshold_bytes") {
 			uint32_t num = duckdb_get_uint32(val.get());
 			this->var_len_params_long_threshold_bytes = num;
 		} else if (en.first == "enable_columns_binding") {
 			this->enable_columns_binding = duckdb_get_bool(val.get());
+		} else if (en.first == "enable_block_fetch") {
+			this->enable_block_fetch = duckdb_get_bool(val.get());
+		} else if (en.first == "enable_prefetch") {
+			this->enable_prefetch = duckdb_get_bool(val.get());
+		} else if (en.first == "prefetch_memory_limit_bytes") {
+			uint32_t num = duckdb_get_uint32(val.get());
+			this->prefetch_memory_limit_bytes = num;
+		} else if (en.first == "varchar_columns_bind_max_bytes") {
+			uint32_t num = duckdb_get_uint32(val.get());
+			this->varchar_columns_bind_max_bytes = num;
 		} else {
 			throw ScannerException("Unsupported user option: '" + en.first + "'");
 		}
 	}
+
+	// Values that do not fit into the bound buffers cannot be re-read from
+	// the rowset, character columns are left unbound with such drivers.
+	if (!conn.getdata_in_bound_rowset) {
+		this->varchar_columns_bind_max_bytes = 0;
+	}
+}
+
+std::string DbmsQuirks::Key() const {
+	std::string res;
+	res.push_back(decimal_columns_as_chars ? '1' : '0');
+	res.push_back(decimal_columns_precision_through_ard ? '1' : '0');
+	res.push_back(decimal_columns_as_ard_type ? '1' : '0');
+	res.push_back(decimal_params_as_chars ? '1' : '0');
+	res.push_back(integral_params_as_decimals ? '1' : '0');
+	res.push_back(reset_stmt_before_execute ? '1' : '0');
+	res.push_back(time_params_as_ss_time2 ? '1' : '0');
+	res.push_back(timestamp_columns_as_timestamp_ns ? '1' : '0');
+	res.push_back(timestamp_columns_with_typename_date_as_date ? '1' : '0');
+	res.append(":" + std::to_string(timestamp_max_fraction_precision) + ":");
+	res.push_back(timestamp_params_as_sf_timestamp_ntz ? '1' : '0');
+	res.push_back(timestamptz_params_as_ss_timestampoffset ? '1' : '0');
+	res.push_back(var_len_data_single_part ? '1' : '0');
+	res.push_back(varchar_columns_as_utf8_chars ? '1' : '0');
+	res.append(":" + std::to_string(var_len_params_long_threshold_bytes) + ":");
+	res.push_back(enable_columns_binding ? '1' : '0');
+	res.push_back(enable_block_fetch ? '1' : '0');
+	res.push_back(enable_prefetch ? '1' : '0');
+	res.append(":" + std::to_string(prefetch_memory_limit_bytes));
+	res.append(":" + std::to_string(varchar_columns_bind_max_bytes));
+	return res;
 }
 
 const std::vector<std::string> DbmsQuirks::AllNames() {
@@ -131,8 +178,13 @@ const std::vector<std::string> DbmsQuirks::AllNames() {
 	res.emplace_back("timestamp_params_as_sf_timestamp_ntz");
 	res.emplace_back("timestamptz_params_as_ss_timestampoffset");
 	res.emplace_back("var_len_data_single_part");
+	res.emplace_back("varchar_columns_as_utf8_chars");
 	res.emplace_back("var_len_params_long_threshold_bytes");
 	res.emplace_back("enable_columns_binding");
+	res.emplace_back("enable_block_fetch");
+	res.emplace_back("enable_prefetch");
+	res.emplace_back("prefetch_memory_limit_bytes");
+	res.emplace_back("varchar_columns_bind_max_bytes");
 	return res;
 }
 
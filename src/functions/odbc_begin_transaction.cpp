@@ -4,7 +4,6 @@
 #include <string>
 
 #include "capi_pointers.hpp"
-#include "defer.hpp"
 #include "diagnostics.hpp"
 #include "registries.hpp"
 #include "scanner_exception.hpp"
@@ -25,16 +24,13 @@ static void BeginTransaction(duckdb_function_info info, duckdb_data_chunk input,
 		throw ScannerException("'odbc_begin_transaction' error: specified ODBC connection must be not NULL");
 	}
 	int64_t conn_id = conn_arg.first;
-	auto conn_ptr = ConnectionsRegistry::Remove(conn_id);
+	auto conn_ptr = ConnectionsRegistry::Lease(conn_id);
 
-	if (conn_ptr.get() == nullptr) {
+	if (!conn_ptr) {
 		throw ScannerException("'odbc_begin_transaction' error: open ODBC connection not found, id: " +
 		                       std::to_string(conn_id));
 	}
 
-	// Return the connection to registry at the end of the block
-	auto deferred_conn = Defer([&conn_ptr] { ConnectionsRegistry::Add(std::move(conn_ptr)); });
-
 	OdbcConnection &conn = *conn_ptr;
 
 	SQLRETURN ret = SQLSetConnectAttr(conn.dbc, SQL_ATTR_AUTOCOMMIT, static_cast<SQLPOINTER>(SQL_AUTOCOMMIT_OFF), 0);
@@ -30,16 +30,13 @@ static void BindParams(duckdb_function_info info, duckdb_data_chunk input, duckd
 		throw ScannerException("'odbc_bind_params' error: specified ODBC connection must be not NULL");
 	}
 	int64_t conn_id = conn_arg.first;
-	auto conn_ptr = ConnectionsRegistry::Remove(conn_id);
+	auto conn_ptr = ConnectionsRegistry::Lease(conn_id);
 
-	if (conn_ptr.get() == nullptr) {
+	if (!conn_ptr) {
 		throw ScannerException("'odbc_bind_params' error: open ODBC connection not found, id: " +
 		                       std::to_string(conn_id));
 	}
 
-	// Return the connection to registry at the end of the block
-	auto deferred_conn = Defer([&conn_ptr] { ConnectionsRegistry::Add(std::move(conn_ptr)); });
-
 	OdbcConnection &conn = *conn_ptr;
 
 	auto handle_arg = Types::ExtractFunctionArg<int64_t>(input, 1);
@@ -47,12 +44,13 @@ static void BindParams(duckdb_function_info info, duckdb_data_chunk input, duckd
 		throw ScannerException("'odbc_bind_params' error: specified parameters handle argument must be not NULL");
 	}
 	int64_t params_handle = handle_arg.first;
-	auto params_ptr = ParamsRegistry::Remove(params_handle);
+	auto params_ptr = ParamsRegistry::Take(params_handle);
 	if (params_ptr.get() == nullptr) {
 		throw ScannerException("'odbc_bind_params' error: specified parameters handle not found, ID: " +
 		                       std::to_string(params_handle));
 	}
-	auto deferred_params = Defer([&params_ptr] { ParamsRegistry::Add(std::move(params_ptr)); });
+	auto deferred_params =
+	    Defer([&params_ptr, params_handle] { ParamsRegistry::Return(params_handle, std::move(params_ptr)); });
 	params_ptr->clear();
 
 	// currently do not support user quirks in 'odbc_bind_params'
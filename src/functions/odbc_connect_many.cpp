@@ -0,0 +1,221 @@
+#include "odbc_scanner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "capi_pointers.hpp"
+#include "connection.hpp"
+#include "make_unique.hpp"
+#include "registries.hpp"
+#include "scanner_exception.hpp"
+#include "types.hpp"
+
+DUCKDB_EXTENSION_EXTERN
+
+static void odbc_connect_many_bind(duckdb_bind_info info) noexcept;
+static void odbc_connect_many_init(duckdb_init_info info) noexcept;
+static void odbc_connect_many_function(duckdb_function_info info, duckdb_data_chunk output) noexcept;
+
+namespace odbcscanner {
+
+namespace {
+
+// all the connections are returned in a single chunk
+static const int64_t MAX_CONNECTIONS_COUNT = 1024;
+
+// number of the connections that are being established at the same time
+static const size_t MAX_CONNECT_THREADS = 16;
+
+struct BindData {
+	std::string conn_str;
+	size_t count;
+
+	explicit BindData(std::string conn_str_in, size_t count_in) : conn_str(std::move(conn_str_in)), count(count_in) {
+	}
+
+	static void Destroy(void *bdata_in) noexcept {
+		auto bdata = reinterpret_cast<BindData *>(bdata_in);
+		delete bdata;
+	}
+};
+
+struct ConnectResult {
+	std::unique_ptr<OdbcConnection> conn;
+	int64_t conn_id = 0;
+	bool failed = false;
+	std::string error;
+};
+
+struct GlobalInitData {
+	std::vector<ConnectResult> results;
+	size_t result_idx = 0;
+
+	static void Destroy(void *gdata_in) noexcept {
+		auto gdata = reinterpret_cast<GlobalInitData *>(gdata_in);
+		delete gdata;
+	}
+};
+
+} // namespace
+
+static void Bind(duckdb_bind_info info) {
+	auto conn_str_val = ValuePtr(duckdb_bind_get_parameter(info, 0), ValueDeleter);
+	if (conn_str_val.get() == nullptr || duckdb_is_null_value(conn_str_val.get())) {
+		throw ScannerException("'odbc_connect_many' error: specified connection string argument must be not NULL");
+	}
+	auto conn_cstr = VarcharPtr(duckdb_get_varchar(conn_str_val.get()), VarcharDeleter);
+	// resolved here, before the worker threads are started, env var fetch is not thread-safe
+	std::string conn_str = OdbcConnection::ResolveDebugConnString(std::string(conn_cstr.get()));
+
+	auto count_val = ValuePtr(duckdb_bind_get_parameter(info, 1), ValueDeleter);
+	if (count_val.get() == nullptr || duckdb_is_null_value(count_val.get())) {
+		throw ScannerException("'odbc_connect_many' error: specified connections count argument must be not NULL");
+	}
+	int64_t count = duckdb_get_int64(count_val.get());
+	if (count < 1 || count > MAX_CONNECTIONS_COUNT) {
+		throw ScannerException("'odbc_connect_many' error: invalid connections count specified: " +
+		                       std::to_string(count) + ", must be between 1 and " +
+		                       std::to_string(MAX_CONNECTIONS_COUNT));
+	}
+
+	auto bigint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_BIGINT), LogicalTypeDeleter);
+	auto varchar_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_VARCHAR), LogicalTypeDeleter);
+	duckdb_bind_add_result_column(info, "conn_id", bigint_type.get());
+	duckdb_bind_add_result_column(info, "error", varchar_type.get());
+
+	duckdb_bind_set_cardinality(info, static_cast<idx_t>(count), true);
+
+	auto bdata_ptr = std_make_unique<BindData>(std::move(conn_str), static_cast<size_t>(count));
+	duckdb_bind_set_bind_data(info, bdata_ptr.release(), BindData::Destroy);
+}
+
+static void ConnectAll(const std::string &conn_str, std::vector<ConnectResult> &results) {
+	std::atomic<size_t> next_idx(0);
+	auto worker = [&conn_str, &results, &next_idx]() {
+		for (size_t idx = next_idx++; idx < results.size(); idx = next_idx++) {
+			ConnectResult &res = results.at(idx);
+			try {
+				res.conn = std_make_unique<OdbcConnection>(conn_str);
+			} catch (std::exception &e) {
+				res.failed = true;
+				res.error = e.what();
+			}
+		}
+	};
+
+	size_t threads_count = std::min(results.size(), MAX_CONNECT_THREADS);
+	std::vector<std::thread> threads;
+	threads.reserve(threads_count);
+	try {
+		for (size_t i = 0; i < threads_count; i++) {
+			threads.emplace_back(worker);
+		}
+	} catch (std::exception &) {
+		// fewer threads than requested, at least one must be started
+		if (threads.empty()) {
+			throw;
+		}
+	}
+	for (std::thread &th : threads) {
+		th.join();
+	}
+}
+
+static void GlobalInit(duckdb_init_info info) {
+	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_init_get_bind_data(info));
+
+	auto gdata_ptr = std_make_unique<GlobalInitData>();
+	gdata_ptr->results.resize(bdata.count);
+
+	ConnectAll(bdata.conn_str, gdata_ptr->results);
+
+	// connections are registered only after all of them are established, failed
+	// connections are reported in the results instead of failing the whole call
+	for (ConnectResult &res : gdata_ptr->results) {
+		if (res.conn.get() != nullptr) {
+			res.conn_id = ConnectionsRegistry::Add(std::move(res.conn));
+		}
+	}
+
+	duckdb_init_set_init_data(info, gdata_ptr.release(), GlobalInitData::Destroy);
+}
+
+static void ConnectMany(duckdb_function_info info, duckdb_data_chunk output) {
+	GlobalInitData &gdata = *reinterpret_cast<GlobalInitData *>(duckdb_function_get_init_data(info));
+
+	duckdb_vector conn_id_vector = duckdb_data_chunk_get_vector(output, 0);
+	duckdb_vector error_vector = duckdb_data_chunk_get_vector(output, 1);
+
+	if (conn_id_vector == nullptr || error_vector == nullptr) {
+		throw ScannerException("'odbc_connect_many' error: invalid null output vector");
+	}
+
+	int64_t *conn_id_data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(conn_id_vector));
+
+	idx_t row_idx = 0;
+	for (; row_idx < duckdb_vector_size() && gdata.result_idx < gdata.results.size(); row_idx++) {
+		const ConnectResult &res = gdata.results.at(gdata.result_idx++);
+		if (!res.failed) {
+			conn_id_data[row_idx] = res.conn_id;
+			Types::SetNullValueToResult(error_vector, row_idx);
+		} else {
+			Types::SetNullValueToResult(conn_id_vector, row_idx);
+			duckdb_vector_assign_string_element_len(error_vector, row_idx, res.error.c_str(), res.error.length());
+		}
+	}
+	duckdb_data_chunk_set_size(output, row_idx);
+}
+
+void OdbcConnectManyFunction::Register(duckdb_connection conn) {
+	auto fun = TableFunctionPtr(duckdb_create_table_function(), TableFunctionDeleter);
+	duckdb_table_function_set_name(fun.get(), "odbc_connect_many");
+
+	// parameters
+	auto varchar_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_VARCHAR), LogicalTypeDeleter);
+	auto bigint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_BIGINT), LogicalTypeDeleter);
+	duckdb_table_function_add_parameter(fun.get(), varchar_type.get());
+	duckdb_table_function_add_parameter(fun.get(), bigint_type.get());
+
+	// callbacks
+	duckdb_table_function_set_bind(fun.get(), odbc_connect_many_bind);
+	duckdb_table_function_set_init(fun.get(), odbc_connect_many_init);
+	duckdb_table_function_set_function(fun.get(), odbc_connect_many_function);
+
+	// register and cleanup
+	duckdb_state state = duckdb_register_table_function(conn, fun.get());
+
+	if (state != DuckDBSuccess) {
+		throw ScannerException("'odbc_connect_many' function registration failed");
+	}
+}
+
+} // namespace odbcscanner
+
+static void odbc_connect_many_bind(duckdb_bind_info info) noexcept {
+	try {
+		odbcscanner::Bind(info);
+	} catch (std::exception &e) {
+		duckdb_bind_set_error(info, e.what());
+	}
+}
+
+static void odbc_connect_many_init(duckdb_init_info info) noexcept {
+	try {
+		odbcscanner::GlobalInit(info);
+	} catch (std::exception &e) {
+		duckdb_init_set_error(info, e.what());
+	}
+}
+
+static void odbc_connect_many_function(duckdb_function_info info, duckdb_data_chunk output) noexcept {
+	try {
+		odbcscanner::ConnectMany(info, output);
+	} catch (std::exception &e) {
+		duckdb_function_set_error(info, e.what());
+	}
+}
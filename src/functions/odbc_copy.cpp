@@ -7,8 +7,8 @@
 #include <vector>
 
 #include "capi_pointers.hpp"
+#include "connection_pool.hpp"
 #include "dbms_quirks.hpp"
-#include "defer.hpp"
 #include "diagnostics.hpp"
 #include "duckdb_extension_api.hpp"
 #include "make_unique.hpp"
@@ -18,6 +18,7 @@
 #include "registries.hpp"
 #include "scanner_exception.hpp"
 #include "scanner_value.hpp"
+#include "statement_pool.hpp"
 #include "strings.hpp"
 #include "types.hpp"
 #include "widechar.hpp"
@@ -111,10 +112,10 @@ struct BindData {
 
 struct GlobalInitData {
 	int64_t conn_id;
-	std::unique_ptr<OdbcConnection> conn_ptr;
+	ConnectionLease conn_ptr;
 	bool close_connection = false;
 
-	GlobalInitData(int64_t conn_id, std::unique_ptr<OdbcConnection> conn_ptr_in, bool close_connection_in)
+	GlobalInitData(int64_t conn_id, ConnectionLease conn_ptr_in, bool close_connection_in)
 	    : conn_id(conn_id), conn_ptr(std::move(conn_ptr_in)), close_connection(close_connection_in) {
 		if (!conn_ptr) {
 			throw ScannerException("'odbc_copy' error: ODBC connection not found on global init, id: " +
@@ -123,10 +124,13 @@ struct GlobalInitData {
 	}
 
 	~GlobalInitData() {
-		if (!close_connection) {
-			// We are not closing the connection, even in case of error,
-			// so need to return connection to registry
-			ConnectionsRegistry::Add(std::move(conn_ptr));
+		// We are not closing the connection, even in case of error,
+		// other calls can use it after the lease is ended
+		conn_ptr.Reset();
+		if (close_connection) {
+			// one-off connection is kept idle in the pool, other connections are closed,
+			// connection that is still leased by other calls is closed after them
+			ConnectionPool::Release(ConnectionsRegistry::Remove(conn_id));
 		}
 	}
 
@@ -607,8 +611,6 @@ static GeneralOptions ExtractGeneralOptions(duckdb_value close_connection_val, b
 static void Bind(duckdb_bind_info info) {
 	auto conn_id_or_str_val = ValuePtr(duckdb_bind_get_parameter(info, 0), ValueDeleter);
 	auto extracted_conn = OdbcConnection::ExtractOrOpen("odbc_copy", conn_id_or_str_val.get());
-	// Return the connection to registry at the end of the block
-	auto deferred = Defer([&extracted_conn] { ConnectionsRegistry::Add(std::move(extracted_conn.ptr)); });
 
 	auto source_conn_string_val = ValuePtr(duckdb_bind_get_named_parameter(info, "source_conn_string"), ValueDeleter);
 	auto source_file_val = ValuePtr(duckdb_bind_get_named_parameter(info, "source_file"), ValueDeleter);
@@ -650,6 +652,11 @@ static void Bind(duckdb_bind_info info) {
 
 	auto close_connection_val = ValuePtr(duckdb_bind_get_named_parameter(info, "close_connection"), ValueDeleter);
 	GeneralOptions general_options = ExtractGeneralOptions(close_connection_val.get(), extracted_conn.must_be_closed);
+	auto pool_without_reset_val =
+	    ValuePtr(duckdb_bind_get_named_parameter(info, "pool_without_session_reset"), ValueDeleter);
+	if (pool_without_reset_val.get() != nullptr && !duckdb_is_null_value(pool_without_reset_val.get())) {
+		ConnectionPool::SetPoolWithoutSessionReset(conn, duckdb_get_bool(pool_without_reset_val.get()));
+	}
 
 	auto bdata_ptr = std_make_unique<BindData>(extracted_conn.id, quirks, std::move(reader_options), insert_options,
 	                                           std::move(create_table_options), general_options);
@@ -671,7 +678,7 @@ static void GlobalInit(duckdb_init_info info) {
 	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_init_get_bind_data(info));
 	// Keep the connection in global data while the function is running
 	// to not allow other threads operate on it or close it.
-	auto conn_ptr = ConnectionsRegistry::Remove(bdata.conn_id);
+	auto conn_ptr = ConnectionsRegistry::Lease(bdata.conn_id);
 	auto gdata_ptr =
 	    std_make_unique<GlobalInitData>(bdata.conn_id, std::move(conn_ptr), bdata.general_options.close_connection);
 	duckdb_init_set_init_data(info, gdata_ptr.release(), GlobalInitData::Destroy);
@@ -1006,14 +1013,12 @@ static void CopyInTransaction(duckdb_function_info info, duckdb_data_chunk outpu
 		ldata.reader = OpenReader(bdata.reader_options);
 		SourceReader &reader = *ldata.reader;
 
-		StmtHandlePtr hstmt(nullptr, StmtHandleDeleter);
+		StmtHandlePtr hstmt(nullptr, StmtHandleDeleter());
 		{
-			HSTMT hstmt_out = SQL_NULL_HSTMT;
-			SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_STMT, conn.dbc, &hstmt_out);
+			SQLRETURN ret = conn.stmt_pool->Alloc(hstmt);
 			if (!SQL_SUCCEEDED(ret)) {
 				throw ScannerException("'SQLAllocHandle' failed for STMT handle, return: " + std::to_string(ret));
 			}
-			hstmt.reset(hstmt_out);
 		}
 
 		if (bdata.create_table_options.do_create_table) {
@@ -1271,6 +1276,7 @@ void OdbcCopyFunction::Register(duckdb_connection conn) {
 	duckdb_table_function_add_named_parameter(fun.get(), "commit_after_create_table", bool_type.get());
 	// general options
 	duckdb_table_function_add_named_parameter(fun.get(), "close_connection", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "pool_without_session_reset", bool_type.get());
 	// quirks
 	duckdb_table_function_add_named_parameter(fun.get(), "decimal_params_as_chars", bool_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "integral_params_as_decimals", bool_type.get());
@@ -1,23 +1,35 @@
 #include "odbc_scanner.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "capi_pointers.hpp"
+#include "cardinality.hpp"
 #include "columns.hpp"
 #include "connection.hpp"
+#include "connection_pool.hpp"
+#include "connection_scheduler.hpp"
 #include "dbms_quirks.hpp"
 #include "defer.hpp"
 #include "diagnostics.hpp"
 #include "make_unique.hpp"
 #include "odbc_api.hpp"
+#include "prefetch.hpp"
 #include "params.hpp"
+#include "partitions.hpp"
 #include "query_context.hpp"
 #include "registries.hpp"
+#include "result_fetch.hpp"
 #include "scanner_exception.hpp"
+#include "statement_cache.hpp"
 #include "types.hpp"
-#include "widechar.hpp"
 
 DUCKDB_EXTENSION_EXTERN
 
@@ -39,15 +51,26 @@ enum class SqlExecStatus { SUCCESS, FAILURE };
 struct QueryOptions {
 	bool ignore_exec_failure = false;
 	bool close_connection = false;
-
-	QueryOptions(bool ignore_exec_failure_in, bool close_connection_in)
-	    : ignore_exec_failure(ignore_exec_failure_in), close_connection(close_connection_in) {
+	bool async_execute = false;
+	// max number of rows returned by the query, 0 when not limited
+	uint64_t max_rows = 0;
+	// max time of the query execution and fetching, 0 when not limited
+	uint32_t query_timeout_seconds = 0;
+	// applies to the one-off connection and to the partitioned scan worker connections
+	bool pool_without_session_reset = false;
+
+	QueryOptions(bool ignore_exec_failure_in, bool close_connection_in, bool async_execute_in, uint64_t max_rows_in,
+	             uint32_t query_timeout_seconds_in, bool pool_without_session_reset_in)
+	    : ignore_exec_failure(ignore_exec_failure_in), close_connection(close_connection_in),
+	      async_execute(async_execute_in), max_rows(max_rows_in), query_timeout_seconds(query_timeout_seconds_in),
+	      pool_without_session_reset(pool_without_session_reset_in) {
 	}
 };
 
 struct BindData {
 	int64_t conn_id = 0;
-	QueryContext ctx;
+	std::string query;
+	DbmsQuirks quirks;
 
 	std::vector<ResultColumn> columns;
 
@@ -57,11 +80,32 @@ struct BindData {
 	std::vector<ScannerValue> params;
 	int64_t params_handle = 0;
 
-	BindData(int64_t conn_id_in, QueryContext ctx_in, std::vector<ResultColumn> columns_in,
+	// partitioned scan
+	std::string conn_url;
+	PartitionOptions partition_options;
+	std::vector<PartitionRange> partition_ranges;
+
+	// Statement prepared on bind is handed over to the global init through the connection
+	// cache. Bind data is shared by all the executions of the DuckDB prepared statement,
+	// so it does not hold the ODBC statement that is executed.
+	std::string stmt_cache_key;
+	uint64_t stmt_generation = 0;
+
+	BindData(int64_t conn_id_in, std::string query_in, DbmsQuirks quirks_in, std::vector<ResultColumn> columns_in,
 	         QueryOptions query_options_in, std::vector<SQLSMALLINT> param_types_in,
-	         std::vector<ScannerValue> params_in, int64_t params_handle_in)
-	    : conn_id(conn_id_in), ctx(std::move(ctx_in)), columns(std::move(columns_in)), query_options(query_options_in),
-	      param_types(std::move(param_types_in)), params(std::move(params_in)), params_handle(params_handle_in) {
+	         std::vector<ScannerValue> params_in, int64_t params_handle_in, std::string conn_url_in,
+	         PartitionOptions partition_options_in, std::vector<PartitionRange> partition_ranges_in,
+	         std::string stmt_cache_key_in, uint64_t stmt_generation_in)
+	    : conn_id(conn_id_in), query(std::move(query_in)), quirks(std::move(quirks_in)), columns(std::move(columns_in)),
+	      query_options(query_options_in),
+	      param_types(std::move(param_types_in)), params(std::move(params_in)), params_handle(params_handle_in),
+	      conn_url(std::move(conn_url_in)), partition_options(std::move(partition_options_in)),
+	      partition_ranges(std::move(partition_ranges_in)), stmt_cache_key(std::move(stmt_cache_key_in)),
+	      stmt_generation(stmt_generation_in) {
+	}
+
+	bool Partitioned() {
+		return partition_ranges.size() > 0;
 	}
 
 	BindData(const BindData &other) = delete;
@@ -83,13 +127,124 @@ struct BindData {
 	}
 };
 
+// Statement executed by the function call along with the state of its results fetching.
+// Owned together with the statement: by the global init data, or, in partitioned scan,
+// by the local init data of every worker. Prefetcher uses the statement handle, so it is
+// stopped before the statement is closed or returned to the cache.
+struct Execution {
+	ExecState state = ExecState::UNINITIALIZED;
+	std::unique_ptr<QueryContext> ctx_ptr;
+	// fetches next rowsets in background, declared after the statement to be destroyed before it
+	std::unique_ptr<Prefetcher> prefetcher;
+	uint64_t rows_returned = 0;
+	// result columns were checked after the statement was executed
+	bool columns_checked = false;
+	// SQL_ATTR_MAX_ROWS is accepted by the driver and must be reset before the statement is cached
+	bool max_rows_attr_set = false;
+	// SQL_ATTR_QUERY_TIMEOUT is accepted by the driver and must be reset before the statement is cached
+	bool query_timeout_attr_set = false;
+
+	Execution() {
+	}
+
+	Execution(const Execution &other) = delete;
+	Execution(Execution &&other) = delete;
+
+	Execution &operator=(const Execution &other) = delete;
+	Execution &operator=(Execution &&other) = delete;
+
+	~Execution() noexcept {
+		Finish();
+	}
+
+	// Results that are not read yet are discarded, for example when
+	// LIMIT is satisfied or when the query is interrupted or failed
+	void Finish() noexcept {
+		if (state == ExecState::EXECUTED && ctx_ptr) {
+			ResultFetch::Abandon(*ctx_ptr, prefetcher);
+			state = ExecState::EXHAUSTED;
+		}
+		prefetcher.reset();
+		if (ctx_ptr) {
+			ctx_ptr->watchdog_timer.reset();
+		}
+	}
+};
+
+// Statement execution started on global init, so the remote query is already
+// running while DuckDB is initializing the rest of the pipeline, including the
+// other 'odbc_query' sources.
+// Parameters are bound before the execution is started, the background thread
+// only uses the statement handle, that is owned by the global init data.
+struct AsyncExecution {
+	HSTMT hstmt;
+	// with SQL_ATTR_ASYNC_ENABLE supported by the driver, SQLExecute is polled
+	bool polling = false;
+	SQLRETURN ret = SQL_STILL_EXECUTING;
+	// otherwise the statement is executed in a background thread
+	std::future<SQLRETURN> future;
+
+	explicit AsyncExecution(HSTMT hstmt_in) : hstmt(hstmt_in) {
+	}
+
+	AsyncExecution(const AsyncExecution &other) = delete;
+	AsyncExecution(AsyncExecution &&other) = delete;
+
+	AsyncExecution &operator=(const AsyncExecution &other) = delete;
+	AsyncExecution &operator=(AsyncExecution &&other) = delete;
+
+	~AsyncExecution() noexcept {
+		if (polling && ret == SQL_STILL_EXECUTING) {
+			// scan is abandoned before the execution is completed, cancelled
+			// call must still be polled until the driver reports its completion
+			SQLCancel(hstmt);
+			Wait();
+			SQLSetStmtAttr(hstmt, SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_OFF), 0);
+		} else if (future.valid()) {
+			SQLCancel(hstmt);
+			future.wait();
+		}
+	}
+
+	// Blocks until the execution is completed, returns the result of SQLExecute
+	SQLRETURN Wait() {
+		if (!polling) {
+			if (future.valid()) {
+				ret = future.get();
+			}
+			return ret;
+		}
+		std::chrono::milliseconds interval(1);
+		while (ret == SQL_STILL_EXECUTING) {
+			std::this_thread::sleep_for(interval);
+			interval = std::min(interval * 2, std::chrono::milliseconds(100));
+			ret = SQLExecute(hstmt);
+		}
+		return ret;
+	}
+};
+
 struct GlobalInitData {
 	int64_t conn_id;
-	std::unique_ptr<OdbcConnection> conn_ptr;
+	ConnectionLease conn_ptr;
 	bool close_connection = false;
-
-	GlobalInitData(int64_t conn_id, std::unique_ptr<OdbcConnection> conn_ptr_in, bool close_connection_in)
-	    : conn_id(conn_id), conn_ptr(std::move(conn_ptr_in)), close_connection(close_connection_in) {
+	std::unique_ptr<PartitionQueue> partition_queue;
+
+	// statement executed by this call, taken from the connection cache or prepared on global init,
+	// not used in partitioned scan
+	Execution exec;
+	uint64_t stmt_generation = 0;
+	// execution of the statement started on global init, declared after
+	// the statement to be completed before it is destroyed
+	std::unique_ptr<AsyncExecution> async_execution;
+
+	BindData &bdata;
+	// statement is not returned to cache after the failed call
+	std::atomic<bool> failed{false};
+
+	GlobalInitData(int64_t conn_id, ConnectionLease conn_ptr_in, bool close_connection_in,
+	               BindData &bdata_in)
+	    : conn_id(conn_id), conn_ptr(std::move(conn_ptr_in)), close_connection(close_connection_in), bdata(bdata_in) {
 		if (!conn_ptr) {
 			throw ScannerException("'odbc_query' error: ODBC connection not found on global init, id: " +
 			                       std::to_string(conn_id));
@@ -97,11 +252,79 @@ struct GlobalInitData {
 	}
 
 	~GlobalInitData() {
-		if (!close_connection) {
-			// We are not closing the connection, even in case of error,
-			// so need to return connection to registry
-			ConnectionsRegistry::Add(std::move(conn_ptr));
+		// execution must be completed before the connection is returned
+		async_execution.reset();
+		ReleaseStatement();
+		exec.ctx_ptr.reset();
+		// We are not closing the connection, even in case of error,
+		// other calls can use it after the lease is ended
+		conn_ptr.Reset();
+		if (close_connection) {
+			// one-off connection is kept idle in the pool, other connections are closed,
+			// connection that is still leased by other calls is closed after them
+			ConnectionPool::Release(ConnectionsRegistry::Remove(conn_id));
+		}
+	}
+
+	// Statement prepared on bind, or returned to cache by the previous call,
+	// is taken when the call is admitted to execute it
+	void TakeStatement() {
+		OdbcConnection &conn = *conn_ptr;
+		stmt_generation = conn.stmt_cache->Generation();
+		CachedStatement cached;
+		if (conn.stmt_cache->Take(bdata.stmt_cache_key, cached)) {
+			exec.ctx_ptr = std_make_unique<QueryContext>(bdata.query, std::move(cached.hstmt_ptr), bdata.quirks);
+			// schema was not changed through this connection since bind
+			exec.columns_checked = cached.columns_checked && stmt_generation == bdata.stmt_generation;
+		} else {
+			exec.ctx_ptr = std_make_unique<QueryContext>(QueryContext::Prepare(conn, bdata.query, bdata.quirks));
+		}
+	}
+
+	// Results are read, cursor is closed so the statement is not active on the
+	// connection anymore and other calls waiting for the connection can be admitted
+	void EndExecution() noexcept {
+		if (exec.ctx_ptr) {
+			SQLFreeStmt(exec.ctx_ptr->hstmt(), SQL_CLOSE);
+		}
+		conn_ptr.Dismiss();
+	}
+
+	void ReleaseStatement() {
+		// prefetcher thread is stopped before the statement is reset and cached
+		exec.Finish();
+		QueryContext *ctx = exec.ctx_ptr.get();
+		if (ctx == nullptr) {
+			return;
+		}
+		if (bdata.columns.size() == 0) {
+			// DDL may change the schema of the cached queries
+			conn_ptr->stmt_cache->Invalidate();
+			return;
+		}
+		// statements of the pooled connection are reused by the next one-off calls
+		bool closed = close_connection && conn_ptr->pool_key.empty();
+		if (failed || closed) {
+			return;
+		}
+		if (exec.query_timeout_attr_set) {
+			SQLRETURN ret =
+			    SQLSetStmtAttr(ctx->hstmt(), SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast<SQLPOINTER>(0), 0);
+			if (!SQL_SUCCEEDED(ret)) {
+				return;
+			}
 		}
+		if (exec.max_rows_attr_set) {
+			// limit must not be applied to the other calls of the cached statement
+			SQLRETURN ret = SQLSetStmtAttr(ctx->hstmt(), SQL_ATTR_MAX_ROWS,
+			                               reinterpret_cast<SQLPOINTER>(SQL_MAX_ROWS_DEFAULT), 0);
+			if (!SQL_SUCCEEDED(ret)) {
+				return;
+			}
+		}
+		CachedStatement stmt(std::move(ctx->hstmt_ptr), Columns::Clone(bdata.columns), bdata.param_types,
+		                     exec.columns_checked);
+		conn_ptr->stmt_cache->Put(bdata.stmt_cache_key, stmt_generation, std::move(stmt));
 	}
 
 	static void Destroy(void *gdata_in) noexcept {
@@ -111,11 +334,27 @@ struct GlobalInitData {
 };
 
 struct LocalInitData {
-	ExecState exec_state = ExecState::UNINITIALIZED;
+	// partitioned scan, connection is borrowed from the pool by every worker thread,
+	// its statement is re-created for every partition processed by this worker
+	std::unique_ptr<OdbcConnection> conn_ptr;
+	Execution exec;
 
 	LocalInitData() {
 	}
 
+	LocalInitData(const LocalInitData &other) = delete;
+	LocalInitData(LocalInitData &&other) = delete;
+
+	LocalInitData &operator=(const LocalInitData &other) = delete;
+	LocalInitData &operator=(LocalInitData &&other) = delete;
+
+	~LocalInitData() noexcept {
+		// statement must be closed before the worker connection is returned to the pool
+		exec.Finish();
+		exec.ctx_ptr.reset();
+		ConnectionPool::Release(std::move(conn_ptr));
+	}
+
 	static void Destroy(void *ldata_in) noexcept {
 		auto ldata = reinterpret_cast<LocalInitData *>(ldata_in);
 		delete ldata;
@@ -125,7 +364,9 @@ struct LocalInitData {
 } // namespace
 
 static QueryOptions ExtractQueryOptions(duckdb_value ignore_exec_failure_val, duckdb_value close_connection_val,
-                                        bool conn_must_be_closed) {
+                                        duckdb_value async_execute_val, duckdb_value max_rows_val,
+                                        duckdb_value query_timeout_seconds_val,
+                                        duckdb_value pool_without_session_reset_val, bool conn_must_be_closed) {
 	bool ignore_exec_failure = false;
 	if (ignore_exec_failure_val != nullptr && !duckdb_is_null_value(ignore_exec_failure_val)) {
 		ignore_exec_failure = duckdb_get_bool(ignore_exec_failure_val);
@@ -138,14 +379,29 @@ static QueryOptions ExtractQueryOptions(duckdb_value ignore_exec_failure_val, du
 			                       "a connection string");
 		}
 	}
-	return QueryOptions(ignore_exec_failure, close_connection);
+	bool async_execute = false;
+	if (async_execute_val != nullptr && !duckdb_is_null_value(async_execute_val)) {
+		async_execute = duckdb_get_bool(async_execute_val);
+	}
+	uint64_t max_rows = 0;
+	if (max_rows_val != nullptr && !duckdb_is_null_value(max_rows_val)) {
+		max_rows = duckdb_get_uint64(max_rows_val);
+	}
+	uint32_t query_timeout_seconds = 0;
+	if (query_timeout_seconds_val != nullptr && !duckdb_is_null_value(query_timeout_seconds_val)) {
+		query_timeout_seconds = duckdb_get_uint32(query_timeout_seconds_val);
+	}
+	bool pool_without_session_reset = false;
+	if (pool_without_session_reset_val != nullptr && !duckdb_is_null_value(pool_without_session_reset_val)) {
+		pool_without_session_reset = duckdb_get_bool(pool_without_session_reset_val);
+	}
+	return QueryOptions(ignore_exec_failure, close_connection, async_execute, max_rows, query_timeout_seconds,
+	                    pool_without_session_reset);
 }
 
 static void Bind(duckdb_bind_info info) {
 	auto conn_id_or_str_val = ValuePtr(duckdb_bind_get_parameter(info, 0), ValueDeleter);
 	auto extracted_conn = OdbcConnection::ExtractOrOpen("odbc_query", conn_id_or_str_val.get());
-	// Return the connection to registry at the end of the block
-	auto deferred = Defer([&extracted_conn] { ConnectionsRegistry::Add(std::move(extracted_conn.ptr)); });
 	OdbcConnection &conn = *extracted_conn.ptr;
 
 	auto query_val = ValuePtr(duckdb_bind_get_parameter(info, 1), ValueDeleter);
@@ -155,33 +411,29 @@ static void Bind(duckdb_bind_info info) {
 	auto query_ptr = VarcharPtr(duckdb_get_varchar(query_val.get()), VarcharDeleter);
 	std::string query(query_ptr.get());
 
-	StmtHandlePtr hstmt(nullptr, StmtHandleDeleter);
-	{
-		HSTMT hstmt_out = SQL_NULL_HSTMT;
-		SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_STMT, conn.dbc, &hstmt_out);
-		if (!SQL_SUCCEEDED(ret)) {
-			throw ScannerException("'SQLAllocHandle' failed for STMT handle, return: " + std::to_string(ret));
-		}
-		hstmt.reset(hstmt_out);
-	}
-	{
-		auto wquery = WideChar::Widen(query.data(), query.length());
-		SQLRETURN ret = SQLPrepareW(hstmt.get(), wquery.data(), wquery.length<SQLINTEGER>());
-		if (!SQL_SUCCEEDED(ret)) {
-			std::string diag = Diagnostics::Read(hstmt.get(), SQL_HANDLE_STMT);
-			throw ScannerException("'SQLPrepare' failed, query: '" + query + "', return: " + std::to_string(ret) +
-			                       ", diagnostics: '" + diag + "'");
-		}
-	}
-
 	auto ignore_exec_failure_val = ValuePtr(duckdb_bind_get_named_parameter(info, "ignore_exec_failure"), ValueDeleter);
 	auto close_connection_val = ValuePtr(duckdb_bind_get_named_parameter(info, "close_connection"), ValueDeleter);
-	QueryOptions query_options =
-	    ExtractQueryOptions(ignore_exec_failure_val.get(), close_connection_val.get(), extracted_conn.must_be_closed);
+	auto async_execute_val = ValuePtr(duckdb_bind_get_named_parameter(info, "async_execute"), ValueDeleter);
+	auto max_rows_val = ValuePtr(duckdb_bind_get_named_parameter(info, "max_rows"), ValueDeleter);
+	auto query_timeout_seconds_val =
+	    ValuePtr(duckdb_bind_get_named_parameter(info, "query_timeout_seconds"), ValueDeleter);
+	auto pool_without_session_reset_val =
+	    ValuePtr(duckdb_bind_get_named_parameter(info, "pool_without_session_reset"), ValueDeleter);
+	QueryOptions query_options = ExtractQueryOptions(
+	    ignore_exec_failure_val.get(), close_connection_val.get(), async_execute_val.get(), max_rows_val.get(),
+	    query_timeout_seconds_val.get(), pool_without_session_reset_val.get(), extracted_conn.must_be_closed);
+	ConnectionPool::SetPoolWithoutSessionReset(conn, query_options.pool_without_session_reset);
 
 	std::map<std::string, ValuePtr> user_quirks = DbmsQuirks::ExtractUserQuirks(info);
 	DbmsQuirks quirks(conn, user_quirks);
-	QueryContext ctx(query, std::move(hstmt), quirks);
+
+	// repeated calls of the same query take the statement and its metadata from the cache
+	std::string stmt_cache_key = StatementCache::Key(query, quirks);
+	uint64_t stmt_generation = conn.stmt_cache->Generation();
+	CachedStatement cached;
+	bool from_cache = conn.stmt_cache->Take(stmt_cache_key, cached);
+	QueryContext ctx = from_cache ? QueryContext(query, std::move(cached.hstmt_ptr), quirks)
+	                              : QueryContext::Prepare(conn, query, quirks);
 
 	std::vector<ScannerValue> params;
 	auto params_val = ValuePtr(duckdb_bind_get_named_parameter(info, "params"), ValueDeleter);
@@ -193,26 +445,60 @@ static void Bind(duckdb_bind_info info) {
 	auto param_handle_val = ValuePtr(duckdb_bind_get_named_parameter(info, "params_handle"), ValueDeleter);
 	if (param_handle_val.get() != nullptr && !duckdb_is_null_value(param_handle_val.get())) {
 		params_handle = duckdb_get_int64(param_handle_val.get());
-		auto params_ptr = ParamsRegistry::Remove(params_handle);
+		auto params_ptr = ParamsRegistry::Take(params_handle);
 		if (params_ptr.get() == nullptr) {
 			throw ScannerException("'odbc_query' error: specified parameters handle not found, ID: " +
 			                       std::to_string(params_handle));
 		}
-		ParamsRegistry::Add(std::move(params_ptr));
+		ParamsRegistry::Return(params_handle, std::move(params_ptr));
 	}
 
-	std::vector<ResultColumn> columns = Columns::Collect(ctx);
+	std::vector<ResultColumn> columns = from_cache ? std::move(cached.columns) : Columns::Collect(ctx);
 
 	// This must go after the Columns::Collect to prevent the crash in MSSQL ODBC driver
 	// https://web.archive.org/web/20251225082810/https://developercommunity.visualstudio.com/t/SQL-Server-ODBC-driver-186-crash-with-S/11021276
 	std::vector<SQLSMALLINT> param_types;
 	if (params_val.get() != nullptr || param_handle_val.get() != nullptr) {
-		param_types = Params::CollectTypes(ctx);
+		param_types = from_cache && cached.param_types.size() > 0 ? std::move(cached.param_types)
+		                                                          : Params::CollectTypes(ctx);
 		if (params_val.get() != nullptr) {
 			Params::SetExpectedTypes(ctx, param_types, params);
 		}
 	}
 
+	PartitionOptions partition_options = Partitions::ExtractOptions(info);
+	std::vector<PartitionRange> partition_ranges;
+	if (partition_options.Enabled()) {
+		if (columns.size() == 0) {
+			throw ScannerException("'odbc_query' error: partitioned scan is only supported for queries that return "
+			                       "a result set, query: '" +
+			                       query + "'");
+		}
+		if (params_handle != 0) {
+			throw ScannerException("'odbc_query' error: partitioned scan cannot be used with 'params_handle', "
+			                       "query: '" +
+			                       query + "'");
+		}
+		if (query_options.max_rows > 0) {
+			throw ScannerException("'odbc_query' error: partitioned scan cannot be used with 'max_rows', "
+			                       "query: '" +
+			                       query + "'");
+		}
+		partition_ranges = Partitions::CreateRanges(conn, ctx, params, partition_options);
+	}
+
+	// Query text is not analyzed, the table to take the estimate from
+	// must be specified explicitly.
+	auto cardinality_table_val = ValuePtr(duckdb_bind_get_named_parameter(info, "cardinality_table"), ValueDeleter);
+	if (cardinality_table_val.get() != nullptr && !duckdb_is_null_value(cardinality_table_val.get())) {
+		auto cardinality_table_ptr = VarcharPtr(duckdb_get_varchar(cardinality_table_val.get()), VarcharDeleter);
+		std::string cardinality_table(cardinality_table_ptr.get());
+		uint64_t cardinality = 0;
+		if (!cardinality_table.empty() && Cardinality::Estimate(conn, cardinality_table, cardinality)) {
+			duckdb_bind_set_cardinality(info, static_cast<idx_t>(cardinality), false);
+		}
+	}
+
 	if (columns.size() == 0) {
 		auto bigint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_BIGINT), LogicalTypeDeleter);
 		duckdb_bind_add_result_column(info, "rowcount", bigint_type.get());
@@ -224,40 +510,70 @@ static void Bind(duckdb_bind_info info) {
 		}
 	}
 
-	auto bdata_ptr =
-	    std::unique_ptr<BindData>(new BindData(extracted_conn.id, std::move(ctx), std::move(columns), query_options,
-	                                           std::move(param_types), std::move(params), params_handle));
+	// statement is taken back from the cache on global init, unless it is evicted or taken by other call
+	bool columns_checked = from_cache && cached.columns_checked;
+	CachedStatement stmt(std::move(ctx.hstmt_ptr), Columns::Clone(columns), param_types, columns_checked);
+	conn.stmt_cache->Put(stmt_cache_key, stmt_generation, std::move(stmt));
+
+	auto bdata_ptr = std::unique_ptr<BindData>(
+	    new BindData(extracted_conn.id, std::move(query), std::move(quirks), std::move(columns), query_options,
+	                 std::move(param_types), std::move(params), params_handle, conn.url, std::move(partition_options),
+	                 std::move(partition_ranges), std::move(stmt_cache_key), stmt_generation));
 	duckdb_bind_set_bind_data(info, bdata_ptr.release(), BindData::Destroy);
 }
 
-static void GlobalInit(duckdb_init_info info) {
-	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_init_get_bind_data(info));
-	// Keep the connection in global data while the function is running
-	// to not allow other threads operate on it or close it.
-	auto conn_ptr = ConnectionsRegistry::Remove(bdata.conn_id);
-	auto gdata_ptr =
-	    std_make_unique<GlobalInitData>(bdata.conn_id, std::move(conn_ptr), bdata.query_options.close_connection);
-	duckdb_init_set_init_data(info, gdata_ptr.release(), GlobalInitData::Destroy);
+static void SetMaxRows(Execution &exec, uint64_t max_rows) {
+	QueryContext &ctx = *exec.ctx_ptr;
+	SQLRETURN ret = SQLSetStmtAttr(ctx.hstmt(), SQL_ATTR_MAX_ROWS,
+	                               reinterpret_cast<SQLPOINTER>(static_cast<uintptr_t>(max_rows)), 0);
+	if (SQL_SUCCEEDED(ret)) {
+		// driver may substitute the value (01S02), limit is enforced in the fetch loop in any case
+		exec.max_rows_attr_set = true;
+		return;
+	}
+	if (ret != SQL_ERROR) {
+		throw ScannerException("'SQLSetStmtAttr' failed, attribute: SQL_ATTR_MAX_ROWS, query: '" + ctx.query +
+		                       "', return: " + std::to_string(ret));
+	}
+	// Attribute is not supported by the driver (usually HYC00 or HY092), its diagnostics
+	// are consumed here to not be mixed with the ones of the execution, and the limit is
+	// only enforced in the fetch loop, remaining rows are discarded on the server.
+	Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+	exec.max_rows_attr_set = false;
 }
 
-static void LocalInit(duckdb_init_info info) {
-	auto ldata_ptr = std_make_unique<LocalInitData>();
-	duckdb_init_set_init_data(info, ldata_ptr.release(), LocalInitData::Destroy);
+static void SetQueryTimeout(Execution &exec, uint32_t timeout_seconds) {
+	QueryContext &ctx = *exec.ctx_ptr;
+	SQLRETURN ret = SQLSetStmtAttr(ctx.hstmt(), SQL_ATTR_QUERY_TIMEOUT,
+	                               reinterpret_cast<SQLPOINTER>(static_cast<uintptr_t>(timeout_seconds)), 0);
+	if (SQL_SUCCEEDED(ret)) {
+		exec.query_timeout_attr_set = true;
+		return;
+	}
+	if (ret != SQL_ERROR) {
+		throw ScannerException("'SQLSetStmtAttr' failed, attribute: SQL_ATTR_QUERY_TIMEOUT, query: '" + ctx.query +
+		                       "', return: " + std::to_string(ret));
+	}
+	// Attribute is not supported by the driver (usually HYC00 or HY092), its diagnostics
+	// are consumed here to not be mixed with the ones of the execution, and the timeout
+	// is only enforced by the watchdog, that cancels the statement from a background thread.
+	Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+	exec.query_timeout_attr_set = false;
 }
 
-static SqlExecStatus BindParamsAndExecute(BindData &bdata) {
-	QueryContext &ctx = bdata.ctx;
-
+static void BindParams(BindData &bdata, Execution &exec) {
+	QueryContext &ctx = *exec.ctx_ptr;
 	if (bdata.params.size() > 0) {
 		Params::BindToOdbc(ctx, bdata.params);
 	} else if (bdata.params_handle != 0) {
-		auto params_ptr = ParamsRegistry::Remove(bdata.params_handle);
+		auto params_ptr = ParamsRegistry::Take(bdata.params_handle);
 		if (params_ptr.get() == nullptr) {
 			throw ScannerException("'odbc_query' error: specified parameters handle not found, ID: " +
 			                       std::to_string(bdata.params_handle));
 		}
-		auto deferred = Defer([&params_ptr] { ParamsRegistry::Add(std::move(params_ptr)); });
-		Params::SetExpectedTypes(bdata.ctx, bdata.param_types, *params_ptr);
+		auto deferred =
+		    Defer([&params_ptr, &bdata] { ParamsRegistry::Return(bdata.params_handle, std::move(params_ptr)); });
+		Params::SetExpectedTypes(ctx, bdata.param_types, *params_ptr);
 		Params::BindToOdbc(ctx, *params_ptr);
 	}
 
@@ -270,46 +586,152 @@ static SqlExecStatus BindParamsAndExecute(BindData &bdata) {
 		}
 	}
 
-	{
-		SQLRETURN ret = SQLExecute(ctx.hstmt());
-		if (!SQL_SUCCEEDED(ret) && ret != SQL_NO_DATA) {
-			if (bdata.query_options.ignore_exec_failure) {
-				return SqlExecStatus::FAILURE;
-			}
-			std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
-			throw ScannerException("'SQLExecute' failed, query: '" + ctx.query + "', return: " + std::to_string(ret) +
-			                       ", diagnostics: '" + diag + "'");
-		}
+	if (bdata.query_options.max_rows > 0) {
+		SetMaxRows(exec, bdata.query_options.max_rows);
 	}
 
+	uint32_t timeout_seconds = bdata.query_options.query_timeout_seconds;
+	if (timeout_seconds > 0) {
+		// Driver timeout is usually only applied to the execution, the watchdog
+		// also covers fetching and is the fallback for the drivers that reject the attribute.
+		SetQueryTimeout(exec, timeout_seconds);
+		ctx.watchdog_timer.reset();
+		ctx.watchdog_timer = std_make_unique<WatchdogTimer>(ctx.hstmt(), timeout_seconds);
+	}
+}
+
+static SqlExecStatus CheckExecResult(BindData &bdata, QueryContext &ctx, SQLRETURN ret) {
+	if (!SQL_SUCCEEDED(ret) && ret != SQL_NO_DATA) {
+		if (bdata.query_options.ignore_exec_failure) {
+			return SqlExecStatus::FAILURE;
+		}
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLExecute' failed, query: '" + ctx.query + "', return: " + std::to_string(ret) +
+		                       ", diagnostics: '" + diag + "'");
+	}
 	return SqlExecStatus::SUCCESS;
 }
 
-static void Query(duckdb_function_info info, duckdb_data_chunk output) {
-	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_function_get_bind_data(info));
-	LocalInitData &ldata = *reinterpret_cast<LocalInitData *>(duckdb_function_get_local_init_data(info));
-	QueryContext &ctx = bdata.ctx;
+// Watchdog cancel does not interrupt the statement between the driver calls,
+// so the deadline is also checked before every execute and fetch call
+static void CheckTimeout(QueryContext &ctx) {
+	if (ctx.watchdog_timer && ctx.watchdog_timer->Expired()) {
+		throw QueryTimeoutException(ctx.watchdog_timer->TimeoutSeconds(), ctx.query);
+	}
+}
 
-	if (ldata.exec_state == ExecState::EXHAUSTED) {
-		duckdb_data_chunk_set_size(output, 0);
+static SqlExecStatus BindParamsAndExecute(BindData &bdata, Execution &exec) {
+	QueryContext &ctx = *exec.ctx_ptr;
+	BindParams(bdata, exec);
+	SQLRETURN ret = SQLExecute(ctx.hstmt());
+	return CheckExecResult(bdata, ctx, ret);
+}
+
+static bool SupportsStatementAsync(OdbcConnection &conn) {
+	SQLUINTEGER mode = SQL_AM_NONE;
+	SQLRETURN ret = SQLGetInfo(conn.dbc, SQL_ASYNC_MODE, &mode, sizeof(mode), nullptr);
+	return SQL_SUCCEEDED(ret) && mode == SQL_AM_STATEMENT;
+}
+
+static std::unique_ptr<AsyncExecution> StartExecution(BindData &bdata, Execution &exec, OdbcConnection &conn) {
+	BindParams(bdata, exec);
+	HSTMT hstmt = exec.ctx_ptr->hstmt();
+	auto async_exec = std_make_unique<AsyncExecution>(hstmt);
+	if (SupportsStatementAsync(conn)) {
+		SQLRETURN ret =
+		    SQLSetStmtAttr(hstmt, SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_ON), 0);
+		if (SQL_SUCCEEDED(ret)) {
+			async_exec->polling = true;
+			async_exec->ret = SQLExecute(hstmt);
+			return async_exec;
+		}
+	}
+	// background thread fallback for drivers without asynchronous execution support
+	async_exec->future = std::async(std::launch::async, [hstmt] { return SQLExecute(hstmt); });
+	return async_exec;
+}
+
+static SqlExecStatus WaitForExecution(BindData &bdata, QueryContext &ctx, AsyncExecution &exec) {
+	SQLRETURN exec_ret = exec.Wait();
+	// diagnostics of the execution are read before the statement is used again
+	SqlExecStatus status = CheckExecResult(bdata, ctx, exec_ret);
+	if (exec.polling) {
+		SQLRETURN ret =
+		    SQLSetStmtAttr(ctx.hstmt(), SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_OFF), 0);
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLSetStmtAttr' failed, attribute: SQL_ATTR_ASYNC_ENABLE, query: '" +
+			                       ctx.query + "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+		}
+	}
+	return status;
+}
+
+static void GlobalInit(duckdb_init_info info) {
+	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_init_get_bind_data(info));
+	// Keep the connection in global data while the function is running to not allow
+	// other threads to close it. Call is admitted by the connection scheduler only while
+	// its statement is executed and its results are read, so other calls that use the same
+	// connection in the same DuckDB query (for example, both sides of a join) are not
+	// blocked for the whole scan. Partitioned scan uses the separate worker connections.
+	auto conn_ptr = ConnectionsRegistry::Lease(bdata.conn_id, false);
+	auto gdata_ptr = std_make_unique<GlobalInitData>(bdata.conn_id, std::move(conn_ptr),
+	                                                 bdata.query_options.close_connection, bdata);
+
+	if (bdata.Partitioned()) {
+		size_t workers_count =
+		    std::min(static_cast<size_t>(bdata.partition_options.count), bdata.partition_ranges.size());
+		gdata_ptr->partition_queue = std_make_unique<PartitionQueue>(bdata.partition_ranges, workers_count);
+		duckdb_init_set_max_threads(info, static_cast<idx_t>(workers_count));
+		duckdb_init_set_init_data(info, gdata_ptr.release(), GlobalInitData::Destroy);
 		return;
 	}
 
-	if (ldata.exec_state == ExecState::UNINITIALIZED) {
-		// run the query
-		SqlExecStatus exec_status = BindParamsAndExecute(bdata);
+	// Execution is started early only if the connection scheduler admits it right away,
+	// the global init does not wait for the other calls that use the same connection.
+	// Otherwise the query is executed on the first fetch.
+	if (bdata.query_options.async_execute && gdata_ptr->conn_ptr.TryAdmit()) {
+		gdata_ptr->TakeStatement();
+		gdata_ptr->async_execution = StartExecution(bdata, gdata_ptr->exec, *gdata_ptr->conn_ptr);
+	}
+	duckdb_init_set_init_data(info, gdata_ptr.release(), GlobalInitData::Destroy);
+}
+
+static void LocalInit(duckdb_init_info info) {
+	auto ldata_ptr = std_make_unique<LocalInitData>();
+	duckdb_init_set_init_data(info, ldata_ptr.release(), LocalInitData::Destroy);
+}
+
+// Returns the number of rows written to the output chunk
+static idx_t ExecuteAndFetch(BindData &bdata, Execution &exec, AsyncExecution *async_execution,
+                             duckdb_data_chunk output) {
+	if (exec.state == ExecState::EXHAUSTED) {
+		return 0;
+	}
+
+	QueryContext &ctx = *exec.ctx_ptr;
+	CheckTimeout(ctx);
+
+	if (exec.state == ExecState::UNINITIALIZED) {
+		// run the query, or wait for the execution started on global init
+		SqlExecStatus exec_status = async_execution != nullptr ? WaitForExecution(bdata, ctx, *async_execution)
+		                                                       : BindParamsAndExecute(bdata, exec);
 
 		// if exec error is not thrown then we return empty result set
 		if (exec_status == SqlExecStatus::FAILURE) {
-			ldata.exec_state = ExecState::EXHAUSTED;
-			duckdb_data_chunk_set_size(output, 0);
-			return;
+			exec.state = ExecState::EXHAUSTED;
+			return 0;
 		}
 
-		ldata.exec_state = ExecState::EXECUTED;
+		exec.state = ExecState::EXECUTED;
+		exec.rows_returned = 0;
 
-		std::vector<ResultColumn> columns = Columns::Collect(ctx);
-		Columns::CheckSame(ctx, bdata.columns, columns);
+		// describe is skipped for the cached statement that was already checked
+		if (!exec.columns_checked) {
+			std::vector<ResultColumn> columns = Columns::Collect(ctx);
+			Columns::CheckSame(ctx, bdata.columns, columns);
+			exec.columns_checked = true;
+		}
 
 		// DDL or DML query
 
@@ -324,26 +746,19 @@ static void Query(duckdb_function_info info, duckdb_data_chunk output) {
 
 			duckdb_vector vec = duckdb_data_chunk_get_vector(output, 0);
 			if (vec == nullptr) {
-				throw ScannerException("Vector is NULL, DDL/DML query: '" + ctx.query +
-				                       "', columns count: " + std::to_string(columns.size()));
+				throw ScannerException("Vector is NULL, DDL/DML query: '" + ctx.query + "'");
 			}
 
 			int64_t *vec_data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(vec));
 			vec_data[0] = static_cast<int64_t>(count);
-			duckdb_data_chunk_set_size(output, 1);
-			ldata.exec_state = ExecState::EXHAUSTED;
-			return;
+			exec.state = ExecState::EXHAUSTED;
+			return 1;
 		}
 
 		// normal query
 
-		ctx.col_binds.resize(bdata.columns.size());
-		for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(bdata.columns.size()); col_idxz++) {
-			// set column descriptors and bind columns
-			ResultColumn &col = bdata.columns.at(col_idxz);
-			SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
-			Types::BindColumn(ctx, col.odbc_type, col_idx);
-		}
+		ResultFetch::BindColumns(ctx, bdata.columns);
+		exec.prefetcher = Prefetcher::Start(ctx);
 	}
 
 	// collect vectors
@@ -358,36 +773,110 @@ static void Query(duckdb_function_info info, duckdb_data_chunk output) {
 		col_vectors.push_back(vec);
 	}
 
-	idx_t row_idx = 0;
-	for (; row_idx < duckdb_vector_size(); row_idx++) {
-		{
-			SQLRETURN ret = SQLFetch(ctx.hstmt());
-			if (!SQL_SUCCEEDED(ret)) {
-				if (ret != SQL_NO_DATA) {
-					std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
-					throw ScannerException("'SQLFetch' failed, query: '" + ctx.query +
-					                       "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
-				}
-				SQLRETURN ret_close = SQLFreeStmt(ctx.hstmt(), SQL_CLOSE);
-				if (!SQL_SUCCEEDED(ret_close)) {
-					std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
-					throw ScannerException("'SQLFreeStmt' with SQL_CLOSE failed, query: '" + ctx.query +
-					                       "', return: " + std::to_string(ret_close) + ", diagnostics: '" + diag + "'");
-				}
-				ldata.exec_state = ExecState::EXHAUSTED;
-				break;
+	CheckTimeout(ctx);
+	bool exhausted = false;
+	idx_t rows_count = ResultFetch::FetchChunk(ctx, bdata.columns, col_vectors, exhausted, exec.prefetcher.get());
+
+	uint64_t max_rows = bdata.query_options.max_rows;
+	if (max_rows > 0 && exec.rows_returned + rows_count >= max_rows) {
+		rows_count = static_cast<idx_t>(max_rows - exec.rows_returned);
+		if (!exhausted) {
+			ResultFetch::Abandon(ctx, exec.prefetcher);
+			exhausted = true;
+		}
+	}
+	exec.rows_returned += rows_count;
+
+	if (exhausted) {
+		// final rowset is consumed, prefetcher does not use the statement after this point
+		exec.state = ExecState::EXHAUSTED;
+		exec.prefetcher.reset();
+		ctx.watchdog_timer.reset();
+	}
+	return rows_count;
+}
+
+static bool StartNextPartition(BindData &bdata, GlobalInitData &gdata, LocalInitData &ldata) {
+	PartitionRange range;
+	if (!gdata.partition_queue->Pull(range)) {
+		return false;
+	}
+	std::string query = range.Query(bdata.query, bdata.partition_options.column);
+
+	if (!ldata.conn_ptr) {
+		ldata.conn_ptr = ConnectionPool::Acquire(bdata.conn_url);
+		ConnectionPool::SetPoolWithoutSessionReset(*ldata.conn_ptr, bdata.query_options.pool_without_session_reset);
+	}
+	// close the statement of the previous partition
+	Execution &exec = ldata.exec;
+	exec.Finish();
+	exec.ctx_ptr.reset();
+
+	exec.ctx_ptr = std_make_unique<QueryContext>(QueryContext::Prepare(*ldata.conn_ptr, query, bdata.quirks));
+	exec.state = ExecState::UNINITIALIZED;
+	exec.columns_checked = false;
+	return true;
+}
+
+static idx_t QueryPartitioned(BindData &bdata, GlobalInitData &gdata, LocalInitData &ldata,
+                              duckdb_data_chunk output) {
+	for (;;) {
+		if (!ldata.exec.ctx_ptr || ldata.exec.state == ExecState::EXHAUSTED) {
+			if (!StartNextPartition(bdata, gdata, ldata)) {
+				return 0;
 			}
+		} else {
+			CheckTimeout(*ldata.exec.ctx_ptr);
+		}
+		idx_t rows_count = ExecuteAndFetch(bdata, ldata.exec, nullptr, output);
+		if (rows_count > 0) {
+			return rows_count;
+		}
+	}
+}
+
+static idx_t QuerySingle(BindData &bdata, GlobalInitData &gdata, duckdb_data_chunk output) {
+	Execution &exec = gdata.exec;
+	if (exec.state == ExecState::UNINITIALIZED) {
+		// no-op if the execution was already started on global init
+		gdata.conn_ptr.Admit();
+		if (!exec.ctx_ptr) {
+			gdata.TakeStatement();
 		}
+	}
+	idx_t rows_count = ExecuteAndFetch(bdata, exec, gdata.async_execution.get(), output);
+	if (exec.state == ExecState::EXHAUSTED && gdata.conn_ptr.Admitted()) {
+		gdata.EndExecution();
+	}
+	return rows_count;
+}
 
-		for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(bdata.columns.size()); col_idxz++) {
-			ResultColumn &col = bdata.columns.at(col_idxz);
-			duckdb_vector vec = col_vectors.at(col_idxz);
-			SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+static void Query(duckdb_function_info info, duckdb_data_chunk output) {
+	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_function_get_bind_data(info));
+	GlobalInitData &gdata = *reinterpret_cast<GlobalInitData *>(duckdb_function_get_init_data(info));
+	LocalInitData &ldata = *reinterpret_cast<LocalInitData *>(duckdb_function_get_local_init_data(info));
 
-			Types::FetchAndSetResult(ctx, col.odbc_type, col_idx, vec, row_idx);
+	Execution &exec = bdata.Partitioned() ? ldata.exec : gdata.exec;
+	idx_t rows_count = 0;
+	try {
+		if (bdata.Partitioned()) {
+			rows_count = QueryPartitioned(bdata, gdata, ldata, output);
+		} else {
+			rows_count = QuerySingle(bdata, gdata, output);
+		}
+	} catch (QueryTimeoutException &) {
+		gdata.failed = true;
+		throw;
+	} catch (std::exception &e) {
+		// statement or its metadata may be invalid
+		gdata.failed = true;
+		QueryContext *ctx = exec.ctx_ptr.get();
+		if (ctx != nullptr && ctx->watchdog_timer && ctx->watchdog_timer->Expired()) {
+			throw QueryTimeoutException(ctx->watchdog_timer->TimeoutSeconds(), ctx->query, e.what());
 		}
+		throw;
 	}
-	duckdb_data_chunk_set_size(output, row_idx);
+	duckdb_data_chunk_set_size(output, rows_count);
 }
 
 void OdbcQueryFunction::Register(duckdb_connection conn) {
@@ -401,14 +890,24 @@ void OdbcQueryFunction::Register(duckdb_connection conn) {
 	auto bool_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_BOOLEAN), LogicalTypeDeleter);
 	auto utinyint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_UTINYINT), LogicalTypeDeleter);
 	auto uint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_UINTEGER), LogicalTypeDeleter);
+	auto ubigint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_UBIGINT), LogicalTypeDeleter);
 	duckdb_table_function_add_parameter(fun.get(), any_type.get());
 	duckdb_table_function_add_parameter(fun.get(), varchar_type.get());
 	// named args
 	duckdb_table_function_add_named_parameter(fun.get(), "ignore_exec_failure", bool_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "close_connection", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "pool_without_session_reset", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "async_execute", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "cardinality_table", varchar_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "max_rows", ubigint_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "query_timeout_seconds", uint_type.get());
 	// query params
 	duckdb_table_function_add_named_parameter(fun.get(), "params", any_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "params_handle", bigint_type.get());
+	// partitioned scan
+	duckdb_table_function_add_named_parameter(fun.get(), "partition_column", varchar_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "partition_count", uint_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "partition_strategy", varchar_type.get());
 	// quirks
 	duckdb_table_function_add_named_parameter(fun.get(), "decimal_columns_as_chars", bool_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "decimal_columns_precision_through_ard", bool_type.get());
@@ -424,8 +923,13 @@ void OdbcQueryFunction::Register(duckdb_connection conn) {
 	duckdb_table_function_add_named_parameter(fun.get(), "timestamp_params_as_sf_timestamp_ntz", bool_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "timestamptz_params_as_ss_timestampoffset", bool_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "var_len_data_single_part", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "varchar_columns_as_utf8_chars", bool_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "var_len_params_long_threshold_bytes", uint_type.get());
 	duckdb_table_function_add_named_parameter(fun.get(), "enable_columns_binding", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "enable_block_fetch", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "enable_prefetch", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "prefetch_memory_limit_bytes", uint_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "varchar_columns_bind_max_bytes", uint_type.get());
 
 	// callbacks
 	duckdb_table_function_set_bind(fun.get(), odbc_query_bind);
@@ -0,0 +1,458 @@
+#include "odbc_scanner.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "capi_pointers.hpp"
+#include "cardinality.hpp"
+#include "columns.hpp"
+#include "connection.hpp"
+#include "connection_pool.hpp"
+#include "dbms_quirks.hpp"
+#include "diagnostics.hpp"
+#include "make_unique.hpp"
+#include "odbc_api.hpp"
+#include "prefetch.hpp"
+#include "query_context.hpp"
+#include "registries.hpp"
+#include "result_fetch.hpp"
+#include "scanner_exception.hpp"
+#include "types.hpp"
+
+DUCKDB_EXTENSION_EXTERN
+
+static void odbc_scan_bind(duckdb_bind_info info) noexcept;
+static void odbc_scan_init(duckdb_init_info info) noexcept;
+static void odbc_scan_function(duckdb_function_info info, duckdb_data_chunk output) noexcept;
+
+namespace odbcscanner {
+
+namespace {
+
+// state of the function call
+enum class ExecState { UNINITIALIZED, EXECUTED, EXHAUSTED };
+
+struct BindData {
+	int64_t conn_id = 0;
+	std::string table;
+	std::string quote_char;
+	DbmsQuirks quirks;
+	bool close_connection = false;
+
+	// all columns of the table, in the order they are exposed to DuckDB
+	std::vector<ResultColumn> columns;
+
+	BindData(int64_t conn_id_in, std::string table_in, std::string quote_char_in, DbmsQuirks quirks_in,
+	         bool close_connection_in, std::vector<ResultColumn> columns_in)
+	    : conn_id(conn_id_in), table(std::move(table_in)), quote_char(std::move(quote_char_in)),
+	      quirks(std::move(quirks_in)), close_connection(close_connection_in), columns(std::move(columns_in)) {
+	}
+
+	BindData(const BindData &other) = delete;
+	BindData(BindData &&other) = delete;
+
+	BindData &operator=(const BindData &other) = delete;
+	BindData &operator=(BindData &&other) = delete;
+
+	static void Destroy(void *bdata_in) noexcept {
+		auto bdata = reinterpret_cast<BindData *>(bdata_in);
+		delete bdata;
+	}
+};
+
+struct GlobalInitData {
+	int64_t conn_id;
+	ConnectionLease conn_ptr;
+	bool close_connection = false;
+	ExecState exec_state = ExecState::UNINITIALIZED;
+
+	// Projected columns that are selected from the remote table and their positions
+	// in the output chunk. Output columns that do not refer to the table columns
+	// (like row ID requested by DuckDB for count(*)) are filled with NULLs.
+	std::vector<ResultColumn> columns;
+	std::vector<idx_t> output_idxs;
+	idx_t output_count = 0;
+
+	// statement is prepared when the call is admitted to execute it
+	std::string query;
+	std::unique_ptr<QueryContext> ctx_ptr;
+	std::unique_ptr<Prefetcher> prefetcher;
+
+	// When none of the table columns is projected, only the number
+	// of rows is fetched from the remote table.
+	uint64_t rows_remaining = 0;
+
+	GlobalInitData(int64_t conn_id, ConnectionLease conn_ptr_in, bool close_connection_in)
+	    : conn_id(conn_id), conn_ptr(std::move(conn_ptr_in)), close_connection(close_connection_in) {
+		if (!conn_ptr) {
+			throw ScannerException("'odbc_scan' error: ODBC connection not found on global init, id: " +
+			                       std::to_string(conn_id));
+		}
+	}
+
+	~GlobalInitData() {
+		// scan is destroyed before all the rows are read, for example when
+		// LIMIT is satisfied or when the query is interrupted or failed
+		if (exec_state == ExecState::EXECUTED && ctx_ptr) {
+			ResultFetch::Abandon(*ctx_ptr, prefetcher);
+		}
+		// statement must be closed before the connection is returned
+		prefetcher.reset();
+		ctx_ptr.reset();
+		// We are not closing the connection, even in case of error,
+		// other calls can use it after the lease is ended
+		conn_ptr.Reset();
+		if (close_connection) {
+			// one-off connection is kept idle in the pool, other connections are closed,
+			// connection that is still leased by other calls is closed after them
+			ConnectionPool::Release(ConnectionsRegistry::Remove(conn_id));
+		}
+	}
+
+	static void Destroy(void *gdata_in) noexcept {
+		auto gdata = reinterpret_cast<GlobalInitData *>(gdata_in);
+		delete gdata;
+	}
+};
+
+} // namespace
+
+static std::string ReadIdentifierQuoteChar(OdbcConnection &conn) {
+	std::vector<char> buf;
+	buf.resize(8);
+	SQLSMALLINT len = 0;
+	SQLRETURN ret =
+	    SQLGetInfo(conn.dbc, SQL_IDENTIFIER_QUOTE_CHAR, buf.data(), static_cast<SQLSMALLINT>(buf.size()), &len);
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(conn.dbc, SQL_HANDLE_DBC);
+		throw ScannerException("'SQLGetInfo' failed for SQL_IDENTIFIER_QUOTE_CHAR, return: " + std::to_string(ret) +
+		                       ", diagnostics: '" + diag + "'");
+	}
+	std::string res(buf.data(), len);
+	// single space is returned when quoted identifiers are not supported
+	if (res == " ") {
+		return std::string();
+	}
+	return res;
+}
+
+static std::string QuoteIdentifier(const std::string &quote_char, const std::string &name) {
+	if (quote_char.empty()) {
+		return name;
+	}
+	std::string res = quote_char;
+	for (char ch : name) {
+		if (quote_char.length() == 1 && ch == quote_char[0]) {
+			res.push_back(ch);
+		}
+		res.push_back(ch);
+	}
+	res.append(quote_char);
+	return res;
+}
+
+static void Execute(QueryContext &ctx) {
+	if (ctx.quirks.reset_stmt_before_execute) {
+		SQLRETURN ret = SQLFreeStmt(ctx.hstmt(), SQL_CLOSE);
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLFreeStmt' with SQL_CLOSE (reset_stmt_before_execute) failed, query: '" +
+			                       ctx.query + "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+		}
+	}
+
+	SQLRETURN ret = SQLExecute(ctx.hstmt());
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLExecute' failed, query: '" + ctx.query + "', return: " + std::to_string(ret) +
+		                       ", diagnostics: '" + diag + "'");
+	}
+}
+
+static void Bind(duckdb_bind_info info) {
+	auto conn_id_or_str_val = ValuePtr(duckdb_bind_get_parameter(info, 0), ValueDeleter);
+	auto extracted_conn = OdbcConnection::ExtractOrOpen("odbc_scan", conn_id_or_str_val.get());
+	OdbcConnection &conn = *extracted_conn.ptr;
+
+	auto table_val = ValuePtr(duckdb_bind_get_parameter(info, 1), ValueDeleter);
+	if (duckdb_is_null_value(table_val.get())) {
+		throw ScannerException("'odbc_scan' error: specified table name must be not NULL");
+	}
+	auto table_ptr = VarcharPtr(duckdb_get_varchar(table_val.get()), VarcharDeleter);
+	std::string table(table_ptr.get());
+	if (table.empty()) {
+		throw ScannerException("'odbc_scan' error: specified table name must be not empty");
+	}
+
+	bool close_connection = extracted_conn.must_be_closed;
+	auto close_connection_val = ValuePtr(duckdb_bind_get_named_parameter(info, "close_connection"), ValueDeleter);
+	if (close_connection_val.get() != nullptr && !duckdb_is_null_value(close_connection_val.get())) {
+		close_connection = duckdb_get_bool(close_connection_val.get());
+		if (extracted_conn.must_be_closed && !close_connection) {
+			throw ScannerException("'odbc_scan' error: 'close_connection=FALSE' option cannot be specified along with "
+			                       "a connection string");
+		}
+	}
+
+	auto pool_without_reset_val =
+	    ValuePtr(duckdb_bind_get_named_parameter(info, "pool_without_session_reset"), ValueDeleter);
+	if (pool_without_reset_val.get() != nullptr && !duckdb_is_null_value(pool_without_reset_val.get())) {
+		ConnectionPool::SetPoolWithoutSessionReset(conn, duckdb_get_bool(pool_without_reset_val.get()));
+	}
+
+	std::map<std::string, ValuePtr> user_quirks = DbmsQuirks::ExtractUserQuirks(info);
+	DbmsQuirks quirks(conn, user_quirks);
+
+	// Table schema is collected from the prepared statement, it is not executed.
+	std::string query = "SELECT * FROM " + table;
+	QueryContext ctx = QueryContext::Prepare(conn, query, quirks);
+	std::vector<ResultColumn> columns = Columns::Collect(ctx);
+	if (columns.size() == 0) {
+		throw ScannerException("'odbc_scan' error: no columns found, table: '" + table + "'");
+	}
+
+	for (ResultColumn &col : columns) {
+		Types::CoalesceColumnType(ctx, col);
+		duckdb_type type_id = Types::ResolveColumnType(ctx, col);
+		Columns::AddToResults(info, type_id, col);
+	}
+
+	std::string quote_char = ReadIdentifierQuoteChar(conn);
+
+	auto estimate_cardinality_val =
+	    ValuePtr(duckdb_bind_get_named_parameter(info, "estimate_cardinality"), ValueDeleter);
+	if (estimate_cardinality_val.get() != nullptr && !duckdb_is_null_value(estimate_cardinality_val.get()) &&
+	    duckdb_get_bool(estimate_cardinality_val.get())) {
+		uint64_t cardinality = 0;
+		if (Cardinality::Estimate(conn, table, cardinality)) {
+			duckdb_bind_set_cardinality(info, static_cast<idx_t>(cardinality), false);
+		}
+	}
+
+	auto bdata_ptr = std::unique_ptr<BindData>(new BindData(extracted_conn.id, std::move(table), std::move(quote_char),
+	                                                        std::move(quirks), close_connection, std::move(columns)));
+	duckdb_bind_set_bind_data(info, bdata_ptr.release(), BindData::Destroy);
+}
+
+static void GlobalInit(duckdb_init_info info) {
+	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_init_get_bind_data(info));
+	// Keep the connection in global data while the function is running to not allow
+	// other threads to close it. Call is admitted by the connection scheduler only
+	// while its statement is executed and its results are read.
+	auto conn_ptr = ConnectionsRegistry::Lease(bdata.conn_id, false);
+	auto gdata_ptr = std_make_unique<GlobalInitData>(bdata.conn_id, std::move(conn_ptr), bdata.close_connection);
+	GlobalInitData &gdata = *gdata_ptr;
+
+	// select only the columns that are projected by DuckDB
+	std::string select_list;
+	gdata.output_count = duckdb_init_get_column_count(info);
+	for (idx_t output_idx = 0; output_idx < gdata.output_count; output_idx++) {
+		idx_t col_idxz = duckdb_init_get_column_index(info, output_idx);
+		if (col_idxz >= static_cast<idx_t>(bdata.columns.size())) {
+			continue;
+		}
+		ResultColumn &col = bdata.columns.at(col_idxz);
+		if (!select_list.empty()) {
+			select_list.append(", ");
+		}
+		select_list.append(QuoteIdentifier(bdata.quote_char, col.name));
+		gdata.columns.emplace_back(col.Clone());
+		gdata.output_idxs.push_back(output_idx);
+	}
+
+	if (gdata.columns.size() > 0) {
+		gdata.query = "SELECT " + select_list + " FROM " + bdata.table;
+	} else {
+		gdata.query = "SELECT COUNT(*) FROM " + bdata.table;
+	}
+
+	duckdb_init_set_init_data(info, gdata_ptr.release(), GlobalInitData::Destroy);
+}
+
+static uint64_t FetchRowsCount(QueryContext &ctx) {
+	SQLRETURN ret = SQLFetch(ctx.hstmt());
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLFetch' failed, query: '" + ctx.query + "', return: " + std::to_string(ret) +
+		                       ", diagnostics: '" + diag + "'");
+	}
+	int64_t count = 0;
+	SQLLEN ind = 0;
+	ret = SQLGetData(ctx.hstmt(), 1, SQL_C_SBIGINT, &count, sizeof(count), &ind);
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLGetData' failed, query: '" + ctx.query + "', return: " + std::to_string(ret) +
+		                       ", diagnostics: '" + diag + "'");
+	}
+	SQLFreeStmt(ctx.hstmt(), SQL_CLOSE);
+	return ind == SQL_NULL_DATA || count < 0 ? 0 : static_cast<uint64_t>(count);
+}
+
+static void SetNulls(duckdb_vector vec, idx_t rows_count) {
+	duckdb_vector_ensure_validity_writable(vec);
+	uint64_t *validity = duckdb_vector_get_validity(vec);
+	for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+		duckdb_validity_set_row_invalid(validity, row_idx);
+	}
+}
+
+// Returns the number of rows written to the output chunk
+static idx_t ExecuteAndFetch(BindData &bdata, GlobalInitData &gdata, duckdb_data_chunk output) {
+	if (gdata.exec_state == ExecState::EXHAUSTED) {
+		return 0;
+	}
+
+	if (gdata.exec_state == ExecState::UNINITIALIZED) {
+		gdata.conn_ptr.Admit();
+		gdata.ctx_ptr =
+		    std_make_unique<QueryContext>(QueryContext::Prepare(*gdata.conn_ptr, gdata.query, bdata.quirks));
+	}
+	QueryContext &ctx = *gdata.ctx_ptr;
+
+	if (gdata.exec_state == ExecState::UNINITIALIZED) {
+		Execute(ctx);
+		gdata.exec_state = ExecState::EXECUTED;
+
+		if (gdata.columns.size() == 0) {
+			gdata.rows_remaining = FetchRowsCount(ctx);
+			// cursor of the count query is already closed
+			gdata.conn_ptr.Dismiss();
+		} else {
+			std::vector<ResultColumn> columns = Columns::Collect(ctx);
+			Columns::CheckSame(ctx, gdata.columns, columns);
+			ResultFetch::BindColumns(ctx, gdata.columns);
+			gdata.prefetcher = Prefetcher::Start(ctx);
+		}
+	}
+
+	idx_t rows_count = 0;
+	if (gdata.columns.size() == 0) {
+		rows_count = static_cast<idx_t>(std::min(gdata.rows_remaining, static_cast<uint64_t>(duckdb_vector_size())));
+		gdata.rows_remaining -= rows_count;
+		if (gdata.rows_remaining == 0) {
+			gdata.exec_state = ExecState::EXHAUSTED;
+		}
+	} else {
+		std::vector<duckdb_vector> col_vectors;
+		for (idx_t output_idx : gdata.output_idxs) {
+			duckdb_vector vec = duckdb_data_chunk_get_vector(output, output_idx);
+			if (vec == nullptr) {
+				throw ScannerException("Vector is NULL, query: '" + ctx.query +
+				                       "', columns count: " + std::to_string(gdata.output_count) +
+				                       ", column index: " + std::to_string(output_idx));
+			}
+			col_vectors.push_back(vec);
+		}
+
+		bool exhausted = false;
+		rows_count = ResultFetch::FetchChunk(ctx, gdata.columns, col_vectors, exhausted, gdata.prefetcher.get());
+		if (exhausted) {
+			// final rowset is consumed, prefetcher does not use the statement after this point
+			gdata.exec_state = ExecState::EXHAUSTED;
+			gdata.prefetcher.reset();
+			// statement is not active anymore, other calls on the connection can be admitted
+			SQLFreeStmt(ctx.hstmt(), SQL_CLOSE);
+			gdata.conn_ptr.Dismiss();
+		}
+	}
+
+	// output columns that are not selected from the table
+	if (gdata.output_idxs.size() < gdata.output_count) {
+		size_t selected_pos = 0;
+		for (idx_t output_idx = 0; output_idx < gdata.output_count; output_idx++) {
+			if (selected_pos < gdata.output_idxs.size() && gdata.output_idxs.at(selected_pos) == output_idx) {
+				selected_pos++;
+				continue;
+			}
+			SetNulls(duckdb_data_chunk_get_vector(output, output_idx), rows_count);
+		}
+	}
+
+	return rows_count;
+}
+
+static void Scan(duckdb_function_info info, duckdb_data_chunk output) {
+	BindData &bdata = *reinterpret_cast<BindData *>(duckdb_function_get_bind_data(info));
+	GlobalInitData &gdata = *reinterpret_cast<GlobalInitData *>(duckdb_function_get_init_data(info));
+	idx_t rows_count = ExecuteAndFetch(bdata, gdata, output);
+	duckdb_data_chunk_set_size(output, rows_count);
+}
+
+void OdbcScanFunction::Register(duckdb_connection conn) {
+	auto fun = TableFunctionPtr(duckdb_create_table_function(), TableFunctionDeleter);
+	duckdb_table_function_set_name(fun.get(), "odbc_scan");
+
+	// parameters
+	auto varchar_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_VARCHAR), LogicalTypeDeleter);
+	auto any_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_ANY), LogicalTypeDeleter);
+	auto bool_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_BOOLEAN), LogicalTypeDeleter);
+	auto utinyint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_UTINYINT), LogicalTypeDeleter);
+	auto uint_type = LogicalTypePtr(duckdb_create_logical_type(DUCKDB_TYPE_UINTEGER), LogicalTypeDeleter);
+	duckdb_table_function_add_parameter(fun.get(), any_type.get());
+	duckdb_table_function_add_parameter(fun.get(), varchar_type.get());
+	// named args
+	duckdb_table_function_add_named_parameter(fun.get(), "close_connection", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "pool_without_session_reset", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "estimate_cardinality", bool_type.get());
+	// quirks
+	duckdb_table_function_add_named_parameter(fun.get(), "decimal_columns_as_chars", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "decimal_columns_precision_through_ard", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "decimal_columns_as_ard_type", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "reset_stmt_before_execute", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "timestamp_columns_as_timestamp_ns", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "timestamp_columns_with_typename_date_as_date",
+	                                          bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "timestamp_max_fraction_precision", utinyint_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "var_len_data_single_part", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "varchar_columns_as_utf8_chars", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "enable_columns_binding", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "enable_block_fetch", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "enable_prefetch", bool_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "prefetch_memory_limit_bytes", uint_type.get());
+	duckdb_table_function_add_named_parameter(fun.get(), "varchar_columns_bind_max_bytes", uint_type.get());
+
+	// only the projected columns are selected from the remote table
+	duckdb_table_function_supports_projection_pushdown(fun.get(), true);
+
+	// callbacks
+	duckdb_table_function_set_bind(fun.get(), odbc_scan_bind);
+	duckdb_table_function_set_init(fun.get(), odbc_scan_init);
+	duckdb_table_function_set_function(fun.get(), odbc_scan_function);
+
+	// register and cleanup
+	duckdb_state state = duckdb_register_table_function(conn, fun.get());
+
+	if (state != DuckDBSuccess) {
+		throw ScannerException("'odbc_scan' function registration failed");
+	}
+}
+
+} // namespace odbcscanner
+
+static void odbc_scan_bind(duckdb_bind_info info) noexcept {
+	try {
+		odbcscanner::Bind(info);
+	} catch (std::exception &e) {
+		duckdb_bind_set_error(info, e.what());
+	}
+}
+
+static void odbc_scan_init(duckdb_init_info info) noexcept {
+	try {
+		odbcscanner::GlobalInit(info);
+	} catch (std::exception &e) {
+		duckdb_init_set_error(info, e.what());
+	}
+}
+
+static void odbc_scan_function(duckdb_function_info info, duckdb_data_chunk output) noexcept {
+	try {
+		odbcscanner::Scan(info, output);
+	} catch (std::exception &e) {
+		duckdb_function_set_error(info, e.what());
+	}
+}
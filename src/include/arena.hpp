@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace odbcscanner {
+
+// Bump allocator for the scratch space of the variable-length column fetchers.
+// Allocated memory is not freed individually, the arena is reset once for every
+// output chunk and the blocks are reused for the next chunk.
+class Arena {
+	struct Block {
+		std::unique_ptr<char[]> data;
+		size_t size = 0;
+
+		Block(std::unique_ptr<char[]> data_in, size_t size_in) : data(std::move(data_in)), size(size_in) {
+		}
+	};
+
+	std::vector<Block> blocks;
+	size_t block_idx = 0;
+	size_t offset = 0;
+
+public:
+	static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+	// blocks larger than this (allocated for large LOB values) are released on reset
+	static const size_t MAX_RETAINED_BLOCK_SIZE = 16 * DEFAULT_BLOCK_SIZE;
+	static const size_t ALIGNMENT = 16;
+
+	Arena() {
+	}
+
+	Arena(Arena &other) = delete;
+	Arena(Arena &&other) = default;
+
+	Arena &operator=(const Arena &other) = delete;
+	Arena &operator=(Arena &&other) = default;
+
+	void *Allocate(size_t size_bytes);
+
+	// Extends or shrinks the allocation in place when it is the last one in the
+	// arena, otherwise allocates a new one and copies the contents
+	void *Reallocate(void *ptr, size_t old_size_bytes, size_t new_size_bytes);
+
+	// Releases all the allocations, retained blocks are reused
+	void Reset();
+
+	// Position in the arena, allocations made after it can be released
+	// at once rewinding the arena back to it
+	struct Mark {
+		size_t block_idx;
+		size_t offset;
+	};
+
+	Mark GetMark() const {
+		Mark res;
+		res.block_idx = block_idx;
+		res.offset = offset;
+		return res;
+	}
+
+	void Rewind(const Mark &mark) {
+		block_idx = mark.block_idx;
+		offset = mark.offset;
+	}
+
+	template <typename T>
+	T *Allocate(size_t count) {
+		return static_cast<T *>(Allocate(count * sizeof(T)));
+	}
+};
+
+// Growable array of trivial values allocated in the arena, used by fetchers
+// in place of std::vector for scratch buffers
+template <typename T>
+class ArenaBuffer {
+	Arena *arena;
+	T *ptr = nullptr;
+	size_t len = 0;
+
+public:
+	explicit ArenaBuffer(Arena &arena_in) : arena(&arena_in) {
+	}
+
+	T *data() {
+		return ptr;
+	}
+
+	size_t size() const {
+		return len;
+	}
+
+	void resize(size_t new_len) {
+		ptr = static_cast<T *>(arena->Reallocate(ptr, len * sizeof(T), new_len * sizeof(T)));
+		len = new_len;
+	}
+};
+
+} // namespace odbcscanner
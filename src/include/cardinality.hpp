@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "connection.hpp"
+
+namespace odbcscanner {
+
+// Approximate number of rows in a remote table, passed to DuckDB planner.
+// The estimate is taken from 'SQLStatistics' (SQL_QUICK), when it is not available
+// for the known drivers it is queried from the DBMS catalog. Both lookups may run
+// statements on the connection, so no estimate is taken inside a transaction.
+// Estimates are cached in the connection, failed lookups are not cached and
+// are not reported as errors.
+struct Cardinality {
+	// Returns false if the estimate is not available
+	static bool Estimate(OdbcConnection &conn, const std::string &table, uint64_t &cardinality_out);
+};
+
+} // namespace odbcscanner
@@ -1,22 +1,32 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
+#include "duckdb_extension_api.hpp"
 #include "odbc_api.hpp"
-#include "scanner_value.hpp"
 
 namespace odbcscanner {
 
+// Buffers for a column bound with SQLBindCol. With block fetch enabled
+// the buffers hold the whole rowset (column-wise binding), otherwise
+// they hold a single row.
+// Columns which ODBC C type has the same layout as DuckDB vector data
+// are not using the values buffer in block fetch mode, they are bound
+// directly to the output vector memory before every fetch.
+// Variable-length columns are bound as fixed-size values of the declared
+// column length, values that do not fit are read with SQLGetData.
 struct ColumnBind {
-	ScannerValue value;
-	SQLLEN ind = 0;
+	std::vector<char> values;
+	std::vector<SQLLEN> inds;
+	SQLSMALLINT ctype = 0;
+	SQLLEN value_size = 0;
+	bool direct = false;
+	bool var_len = false;
 
 	ColumnBind() {
 	}
 
-	ColumnBind(ScannerValue value_in) : value(std::move(value_in)) {
-	}
-
 	ColumnBind(const ColumnBind &other) = delete;
 	ColumnBind(ColumnBind &&other) = default;
 
@@ -24,12 +34,79 @@ struct ColumnBind {
 	ColumnBind &operator=(ColumnBind &&other) = default;
 
 	template <typename T>
-	T &Value() {
-		return value.Value<T>();
+	static ColumnBind Create(SQLSMALLINT ctype, SQLULEN rowset_size) {
+		ColumnBind res;
+		res.values.resize(sizeof(T) * rowset_size, 0);
+		res.inds.resize(rowset_size, 0);
+		res.ctype = ctype;
+		res.value_size = static_cast<SQLLEN>(sizeof(T));
+		return res;
+	}
+
+	template <typename T>
+	static ColumnBind CreateDirect(SQLSMALLINT ctype, SQLULEN rowset_size) {
+		ColumnBind res;
+		res.inds.resize(rowset_size, 0);
+		res.ctype = ctype;
+		res.value_size = static_cast<SQLLEN>(sizeof(T));
+		res.direct = true;
+		return res;
+	}
+
+	// Creates buffers for values of the specified size, used for
+	// the values returned as character data
+	static ColumnBind CreateSized(SQLSMALLINT ctype, SQLLEN value_size, SQLULEN rowset_size) {
+		ColumnBind res;
+		res.values.resize(static_cast<size_t>(value_size) * rowset_size, 0);
+		res.inds.resize(rowset_size, 0);
+		res.ctype = ctype;
+		res.value_size = value_size;
+		return res;
+	}
+
+	static ColumnBind CreateVarLen(SQLSMALLINT ctype, SQLLEN value_size, SQLULEN rowset_size) {
+		ColumnBind res = CreateSized(ctype, value_size, rowset_size);
+		res.var_len = true;
+		return res;
+	}
+
+	// Creates buffers of the same layout as the specified bind, used
+	// to fetch multiple rowsets of the same statement
+	static ColumnBind CreateSameLayout(const ColumnBind &other, SQLULEN rowset_size) {
+		ColumnBind res;
+		res.values.resize(static_cast<size_t>(other.value_size) * rowset_size, 0);
+		res.inds.resize(rowset_size, 0);
+		res.ctype = other.ctype;
+		res.value_size = other.value_size;
+		res.var_len = other.var_len;
+		return res;
+	}
+
+	bool IsBound() {
+		return inds.size() > 0;
+	}
+
+	bool IsDirect() {
+		return direct;
+	}
+
+	bool IsVarLen() {
+		return var_len;
+	}
+
+	template <typename T>
+	T &Value(idx_t row_idx = 0) {
+		T *arr = reinterpret_cast<T *>(values.data());
+		return arr[row_idx];
+	}
+
+	template <typename T>
+	T *SizedValue(idx_t row_idx = 0) {
+		return reinterpret_cast<T *>(values.data() + static_cast<size_t>(value_size) * row_idx);
 	}
 
-	SQLLEN &Indicator() {
-		return ind;
+	SQLLEN &Indicator(idx_t row_idx = 0) {
+		return inds[row_idx];
 	}
 };
 
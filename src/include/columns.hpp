@@ -23,6 +23,13 @@ struct ResultColumn {
 
 	ResultColumn &operator=(const ResultColumn &other) = delete;
 	ResultColumn &operator=(ResultColumn &&other) = default;
+
+	ResultColumn Clone() const {
+		OdbcType type_copy(odbc_type.desc_type, odbc_type.desc_concise_type, odbc_type.is_unsigned,
+		                   odbc_type.desc_type_name, odbc_type.decimal_precision, odbc_type.decimal_scale,
+		                   odbc_type.desc_length, odbc_type.desc_octet_length);
+		return ResultColumn(name, std::move(type_copy));
+	}
 };
 
 struct Columns {
@@ -30,6 +37,8 @@ struct Columns {
 
 	static void CheckSame(QueryContext &ctx, std::vector<ResultColumn> &expected, std::vector<ResultColumn> &actual);
 
+	static std::vector<ResultColumn> Clone(const std::vector<ResultColumn> &columns);
+
 	static void AddToResults(duckdb_bind_info info, duckdb_type type_id, ResultColumn &col);
 };
 
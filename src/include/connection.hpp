@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "duckdb_extension_api.hpp"
@@ -27,13 +30,36 @@ enum class DbmsDriver {
 };
 
 struct ExtractedConnection;
+class ConnectionScheduler;
+class StatementCache;
+class StatementPool;
 
 struct OdbcConnection {
+	// shared by all the connections, is not freed with the connection
 	SQLHANDLE env = nullptr;
 	SQLHANDLE dbc = nullptr;
 	DbmsDriver driver;
-
-	OdbcConnection(const std::string &url);
+	// driver allows SQLGetData on bound columns in a multi-row rowset after
+	// positioning the cursor with SQLSetPos, required to re-read truncated values
+	bool getdata_in_bound_rowset = false;
+	// kept to open additional connections for partitioned scans
+	std::string url;
+	// set when the connection is opened by the connection pool, empty otherwise
+	std::string pool_key;
+	// connection is kept in the pool on release even if the driver cannot reset its session,
+	// only the open transaction is rolled back, set by the call that borrowed the connection
+	bool pool_without_session_reset = false;
+	// estimated rows count for tables, -1 when the estimate is not available
+	std::map<std::string, int64_t> cardinality_cache;
+	std::mutex cardinality_mutex;
+	// idle statement handles, shared with the handles that were allocated from it
+	std::shared_ptr<StatementPool> stmt_pool;
+	// prepared statements of the repeated queries
+	std::unique_ptr<StatementCache> stmt_cache;
+	// admits the calls that use the connection concurrently
+	std::unique_ptr<ConnectionScheduler> scheduler;
+
+	OdbcConnection(const std::string &url_in);
 	~OdbcConnection() noexcept;
 
 	OdbcConnection(OdbcConnection &other) = delete;
@@ -43,14 +69,81 @@ struct OdbcConnection {
 	OdbcConnection &operator=(OdbcConnection &&other) = delete;
 
 	static ExtractedConnection ExtractOrOpen(const std::string &function_name, duckdb_value conn_id_or_str_val);
+
+	// Returns the connection string from the env var specified as 'ODBCSCANNER_DEBUG_CONN_STRING_ENV_VAR=VAR_NAME',
+	// returns other connection strings unchanged
+	static std::string ResolveDebugConnString(const std::string &conn_str);
+};
+
+// Use of the registered connection by a single function call, the connection is not
+// closed while it is leased. Connection can be leased by multiple calls at the same time.
+// Calls are admitted by the connection scheduler, that limits the number of active
+// statements, only while they execute statements on the connection.
+class ConnectionLease {
+	int64_t conn_id = -1;
+	OdbcConnection *conn = nullptr;
+	bool admitted = false;
+
+public:
+	ConnectionLease() {
+	}
+
+	ConnectionLease(int64_t conn_id_in, OdbcConnection *conn_in) : conn_id(conn_id_in), conn(conn_in) {
+	}
+
+	~ConnectionLease() noexcept {
+		Reset();
+	}
+
+	ConnectionLease(const ConnectionLease &other) = delete;
+	ConnectionLease(ConnectionLease &&other) noexcept;
+
+	ConnectionLease &operator=(const ConnectionLease &other) = delete;
+	ConnectionLease &operator=(ConnectionLease &&other) noexcept;
+
+	OdbcConnection *get() {
+		return conn;
+	}
+
+	OdbcConnection &operator*() {
+		return *conn;
+	}
+
+	OdbcConnection *operator->() {
+		return conn;
+	}
+
+	explicit operator bool() const {
+		return conn != nullptr;
+	}
+
+	// Waits for the connection scheduler to admit the statement execution,
+	// throws if the call is not admitted before the timeout
+	void Admit();
+
+	// Does not wait for the connection scheduler, returns false if
+	// the statement execution cannot be admitted right away
+	bool TryAdmit();
+
+	// Ends the statement execution, allows other calls to be admitted,
+	// statement cursor must be closed before it
+	void Dismiss() noexcept;
+
+	bool Admitted() {
+		return admitted;
+	}
+
+	// Ends the lease, the connection that was removed from the registry
+	// while it was leased is closed when its last lease is ended
+	void Reset() noexcept;
 };
 
 struct ExtractedConnection {
 	int64_t id = -1;
-	std::unique_ptr<OdbcConnection> ptr;
+	ConnectionLease ptr;
 	bool must_be_closed = false;
 
-	ExtractedConnection(int64_t id_in, std::unique_ptr<OdbcConnection> ptr_in, bool must_be_closed_in)
+	ExtractedConnection(int64_t id_in, ConnectionLease ptr_in, bool must_be_closed_in)
 	    : id(id_in), ptr(std::move(ptr_in)), must_be_closed(std::move(must_be_closed_in)) {
 	}
 };
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "connection.hpp"
+
+namespace odbcscanner {
+
+// Process-wide pool of the connections opened from connection strings passed
+// directly to the functions (one-off calls). Instead of being closed at the end
+// of the call, the connection is kept idle and is borrowed by the next call with
+// the same connection string, so it does not need to connect and authenticate again.
+// Idle connections are checked with SQL_ATTR_CONNECTION_DEAD before being borrowed.
+// On release the open transaction is rolled back and the session is reset with
+// SQL_ATTR_RESET_CONNECTION. Connections of the drivers that do not support it are
+// not pooled, unless the call specifies 'pool_without_session_reset=TRUE', then the
+// session state (session variables, temporary tables) is visible to the next call.
+struct ConnectionPool {
+	// idle connections kept for every connection string
+	static const size_t MAX_IDLE_CONNECTIONS = 4;
+	// idle connections kept for every connection string after the idle timeout
+	static const size_t MIN_IDLE_CONNECTIONS = 1;
+	static const uint32_t IDLE_TIMEOUT_SECONDS = 300;
+
+	// Returns an idle connection opened with the same connection string, or opens a new one
+	static std::unique_ptr<OdbcConnection> Acquire(const std::string &url);
+
+	// Keeps the connection idle if it was borrowed from the pool and its session
+	// is reset, closes it otherwise
+	static void Release(std::unique_ptr<OdbcConnection> conn) noexcept;
+
+	// Applies the 'pool_without_session_reset' option of the call to the connection borrowed
+	// from the pool, connections that are not pooled are not changed
+	static void SetPoolWithoutSessionReset(OdbcConnection &conn, bool enabled);
+};
+
+} // namespace odbcscanner
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <mutex>
+
+namespace odbcscanner {
+
+// Admits the function calls that use the same connection concurrently, every call
+// uses its own statement handles. When the driver supports only a limited number of
+// active statements on a connection, the calls over the limit wait for the running
+// calls in the order they arrived.
+class ConnectionScheduler {
+	std::mutex mutex;
+	std::condition_variable cv;
+	// 0 when the number of active calls is not limited
+	uint32_t max_active = 1;
+	uint32_t active = 0;
+	uint64_t last_ticket = 0;
+	std::list<uint64_t> waiting;
+
+public:
+	static const uint32_t WAIT_TIMEOUT_SECONDS = 30;
+
+	explicit ConnectionScheduler(uint32_t max_active_in) : max_active(max_active_in) {
+	}
+
+	ConnectionScheduler(const ConnectionScheduler &other) = delete;
+	ConnectionScheduler(ConnectionScheduler &&other) = delete;
+
+	ConnectionScheduler &operator=(const ConnectionScheduler &other) = delete;
+	ConnectionScheduler &operator=(ConnectionScheduler &&other) = delete;
+
+	// Returns false if the call was not admitted before the timeout
+	bool Enter(uint32_t timeout_seconds);
+
+	// Does not wait, returns false if the call cannot be admitted right away
+	bool TryEnter();
+
+	void Leave() noexcept;
+
+	uint32_t MaxActive() {
+		return max_active;
+	}
+};
+
+} // namespace odbcscanner
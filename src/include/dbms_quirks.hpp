@@ -25,11 +25,19 @@ struct DbmsQuirks {
 	bool timestamp_params_as_sf_timestamp_ntz = false;
 	bool timestamptz_params_as_ss_timestampoffset = false;
 	bool var_len_data_single_part = false;
+	bool varchar_columns_as_utf8_chars = false;
 	uint32_t var_len_params_long_threshold_bytes = 4000;
 	bool enable_columns_binding = false;
+	bool enable_block_fetch = false;
+	bool enable_prefetch = false;
+	uint32_t prefetch_memory_limit_bytes = 64 * 1024 * 1024;
+	uint32_t varchar_columns_bind_max_bytes = 1024;
 
 	explicit DbmsQuirks(OdbcConnection &conn, const std::map<std::string, ValuePtr> &user_quirks);
 
+	// Compact representation of all the quirks values, used in cache keys
+	std::string Key() const;
+
 	static const std::vector<std::string> AllNames();
 
 	static std::map<std::string, ValuePtr> ExtractUserQuirks(duckdb_bind_info info);
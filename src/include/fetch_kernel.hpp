@@ -0,0 +1,26 @@
+#pragma once
+
+#include "duckdb_extension_api.hpp"
+#include "odbc_api.hpp"
+
+namespace odbcscanner {
+
+struct QueryContext;
+struct OdbcType;
+
+// Type-specific conversion of a single result column, resolved once
+// from the column type when the columns are bound, so no per-value
+// type dispatch is done when the results are fetched.
+struct FetchKernel {
+	typedef void (*FetchValueFunction)(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+	                                   duckdb_vector vec, idx_t row_idx);
+	typedef void (*FetchRowsFunction)(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+	                                  duckdb_vector vec, idx_t rows_count);
+
+	// reads a single value of the current row, used with row-by-row fetch
+	FetchValueFunction fetch_value = nullptr;
+	// converts all the values of the fetched rowset, used with block fetch
+	FetchRowsFunction fetch_rows = nullptr;
+};
+
+} // namespace odbcscanner
@@ -27,11 +27,21 @@ inline void EnvHandleDeleter(SQLHANDLE env) {
 	SQLFreeHandle(SQL_HANDLE_ENV, env);
 }
 
-using StmtHandlePtr = std::unique_ptr<void, void (*)(HSTMT)>;
+class StatementPool;
 
-inline void StmtHandleDeleter(HSTMT hstmt) {
-	SQLFreeStmt(hstmt, SQL_CLOSE);
-	SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-}
+// Returns the statement to the pool of its connection, frees the statement if it was not allocated from the pool
+struct StmtHandleDeleter {
+	std::shared_ptr<StatementPool> pool;
+
+	StmtHandleDeleter() {
+	}
+
+	explicit StmtHandleDeleter(std::shared_ptr<StatementPool> pool_in) : pool(std::move(pool_in)) {
+	}
+
+	void operator()(HSTMT hstmt) const;
+};
+
+using StmtHandlePtr = std::unique_ptr<void, StmtHandleDeleter>;
 
 } // namespace odbcscanner
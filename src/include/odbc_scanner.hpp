@@ -24,6 +24,10 @@ struct OdbcConnectFunction {
 	static void Register(duckdb_connection connection);
 };
 
+struct OdbcConnectManyFunction {
+	static void Register(duckdb_connection connection);
+};
+
 struct OdbcCopyFunction {
 	static void Register(duckdb_connection connection);
 };
@@ -48,4 +52,8 @@ struct OdbcRollbackFunction {
 	static void Register(duckdb_connection connection);
 };
 
+struct OdbcScanFunction {
+	static void Register(duckdb_connection connection);
+};
+
 } // namespace odbcscanner
\ No newline at end of file
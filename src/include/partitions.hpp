@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "connection.hpp"
+#include "duckdb_extension_api.hpp"
+#include "query_context.hpp"
+#include "scanner_value.hpp"
+
+namespace odbcscanner {
+
+enum class PartitionStrategy { RANGE, QUANTILE, MODULO };
+
+// Partitioned scan splits the result of the user query into multiple parts
+// using predicates on an integral column. Parts are fetched by a number of
+// worker threads, every worker uses its own ODBC connection.
+struct PartitionOptions {
+	std::string column;
+	uint32_t count = 0;
+	PartitionStrategy strategy = PartitionStrategy::RANGE;
+
+	// With RANGE and QUANTILE strategies the key domain is cut into more ranges
+	// than there are workers, so the skewed ranges do not leave most of the
+	// work to a single worker.
+	static const uint32_t RANGES_PER_WORKER = 8;
+
+	PartitionOptions() {
+	}
+
+	PartitionOptions(std::string column_in, uint32_t count_in, PartitionStrategy strategy_in)
+	    : column(std::move(column_in)), count(count_in), strategy(strategy_in) {
+	}
+
+	bool Enabled() const {
+		return count > 1;
+	}
+};
+
+// Key range [lower, upper) of a single partition. The first range is not
+// bounded from below and also includes NULL keys, the last range is not bounded
+// from above. Modulo partitions are not ranges and only carry the predicate.
+struct PartitionRange {
+	int64_t lower = 0;
+	int64_t upper = 0;
+	bool first = false;
+	bool last = false;
+	std::string predicate;
+
+	PartitionRange() {
+	}
+
+	PartitionRange(int64_t lower_in, int64_t upper_in, bool first_in, bool last_in)
+	    : lower(lower_in), upper(upper_in), first(first_in), last(last_in) {
+	}
+
+	explicit PartitionRange(std::string predicate_in) : predicate(std::move(predicate_in)) {
+	}
+
+	uint64_t Width() const;
+
+	std::string Query(const std::string &query, const std::string &column) const;
+};
+
+// Queue of not yet processed ranges shared between workers. When the queue
+// is running low, the widest remaining range is split in halves on every
+// pull, so the workers that finish early can take over the part of it.
+class PartitionQueue {
+	std::mutex mutex;
+	std::deque<PartitionRange> ranges;
+	size_t workers_count;
+
+public:
+	PartitionQueue(std::vector<PartitionRange> ranges_in, size_t workers_count_in);
+
+	PartitionQueue(const PartitionQueue &other) = delete;
+	PartitionQueue(PartitionQueue &&other) = delete;
+
+	PartitionQueue &operator=(const PartitionQueue &other) = delete;
+	PartitionQueue &operator=(PartitionQueue &&other) = delete;
+
+	// Returns false when the queue is drained
+	bool Pull(PartitionRange &range_out);
+};
+
+struct Partitions {
+	static PartitionOptions ExtractOptions(duckdb_bind_info info);
+
+	// Creates ranges of all partitions. For the RANGE and QUANTILE strategies
+	// the boundaries are resolved running a query on the specified connection.
+	static std::vector<PartitionRange> CreateRanges(OdbcConnection &conn, QueryContext &ctx,
+	                                                std::vector<ScannerValue> &params,
+	                                                const PartitionOptions &options);
+};
+
+} // namespace odbcscanner
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "column_bind.hpp"
+#include "odbc_api.hpp"
+#include "query_context.hpp"
+
+namespace odbcscanner {
+
+// Fetches the rowsets of an executed statement in a background thread
+// into a ring of staging buffers, while the previously fetched rowset
+// is converted into DuckDB vectors. Can only be used in block fetch
+// mode, when all the result columns are bound.
+class Prefetcher {
+	struct Rowset {
+		std::vector<ColumnBind> col_binds;
+		std::vector<SQLUSMALLINT> row_statuses;
+		SQLULEN rows_fetched = 0;
+	};
+
+	HSTMT hstmt;
+	std::string query;
+	// owned by the context, is destroyed after the prefetcher, nullptr without the query timeout
+	WatchdogTimer *watchdog_timer;
+	std::vector<Rowset> rowsets;
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque<size_t> free_idxs;
+	std::deque<size_t> ready_idxs;
+	size_t current_idx;
+	bool done = false;
+	bool stop = false;
+	std::string error;
+	bool timed_out = false;
+
+	std::thread thread;
+
+	void Run();
+
+	bool FetchRowset(Rowset &rowset);
+
+public:
+	static const size_t MAX_ROWSETS = 3;
+
+	Prefetcher(QueryContext &ctx, size_t rowsets_count);
+
+	~Prefetcher() noexcept;
+
+	Prefetcher(const Prefetcher &other) = delete;
+	Prefetcher(Prefetcher &&other) = delete;
+
+	Prefetcher &operator=(const Prefetcher &other) = delete;
+	Prefetcher &operator=(Prefetcher &&other) = delete;
+
+	// Starts fetching in background if it is enabled by quirks and the
+	// memory limit allows to keep at least two rowsets, returns nullptr otherwise.
+	static std::unique_ptr<Prefetcher> Start(QueryContext &ctx);
+
+	// Moves the buffers of the next fetched rowset into the context,
+	// returns false when there are no more rows.
+	bool Next(QueryContext &ctx);
+
+	// Gives the buffers of the current rowset back to the fetching thread.
+	void Release(QueryContext &ctx);
+};
+
+} // namespace odbcscanner
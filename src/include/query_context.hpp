@@ -1,11 +1,15 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "arena.hpp"
 #include "column_bind.hpp"
 #include "dbms_quirks.hpp"
+#include "fetch_kernel.hpp"
 #include "odbc_api.hpp"
+#include "watchdog.hpp"
 
 namespace odbcscanner {
 
@@ -14,6 +18,17 @@ struct QueryContext {
 	StmtHandlePtr hstmt_ptr;
 	DbmsQuirks quirks;
 	std::vector<ColumnBind> col_binds;
+	// conversion functions resolved for every result column
+	std::vector<FetchKernel> fetch_kernels;
+	// number of rows fetched with a single SQLFetch call, greater than 1 in block fetch mode
+	SQLULEN rowset_size = 1;
+	SQLULEN rows_fetched = 0;
+	std::vector<SQLUSMALLINT> row_statuses;
+	// scratch space for variable-length columns fetching, reset for every chunk
+	Arena arena;
+	// cancels the statement when the query timeout expires, declared
+	// after the statement handle to be destroyed before it
+	std::unique_ptr<WatchdogTimer> watchdog_timer;
 
 	explicit QueryContext(std::string query_in, StmtHandlePtr hstmt_ptr_in, DbmsQuirks quirks_in)
 	    : query(std::move(query_in)), hstmt_ptr(std::move(hstmt_ptr_in)), quirks(std::move(quirks_in)) {
@@ -25,11 +40,19 @@ struct QueryContext {
 	QueryContext &operator=(const QueryContext &other) = delete;
 	QueryContext &operator=(QueryContext &&other) = default;
 
+	// Allocates a statement on the specified connection and prepares the query with it
+	static QueryContext Prepare(OdbcConnection &conn, std::string query, DbmsQuirks quirks);
+
 	ColumnBind &BindForColumn(SQLSMALLINT col_idx) {
 		size_t col_idxz = static_cast<size_t>(col_idx - 1);
 		return col_binds.at(col_idxz);
 	}
 
+	// Row index in bound column buffers for the specified row of the result vector
+	idx_t BoundRowIdx(idx_t row_idx) {
+		return rowset_size > 1 ? row_idx : 0;
+	}
+
 	HSTMT hstmt() {
 		return hstmt_ptr.get();
 	}
@@ -9,16 +9,32 @@
 
 namespace odbcscanner {
 
+// Registered objects are identified by the handle IDs that are returned to the user.
+// ID includes the generation of its slot in the registry, so the ID of the removed
+// object is not matched by the object that is registered later in the same slot.
+// While the params are taken out for use, their ID stays reserved and they are not
+// found by other calls, they must be returned with the same ID after the use.
+// Connections stay in the registry while they are leased.
+
 struct ConnectionsRegistry {
 	static int64_t Add(std::unique_ptr<OdbcConnection> conn);
 
+	// Returns an empty pointer if the connection is leased, it is closed when its last lease is ended
 	static std::unique_ptr<OdbcConnection> Remove(int64_t conn_id);
+
+	// Returns an empty lease if the connection is not found. When 'admit' is specified,
+	// throws if the connection scheduler does not admit the call before the timeout.
+	static ConnectionLease Lease(int64_t conn_id, bool admit = true);
 };
 
 struct ParamsRegistry {
 	static int64_t Add(std::unique_ptr<std::vector<ScannerValue>> params);
 
 	static std::unique_ptr<std::vector<ScannerValue>> Remove(int64_t params_id);
+
+	static std::unique_ptr<std::vector<ScannerValue>> Take(int64_t params_id);
+
+	static void Return(int64_t params_id, std::unique_ptr<std::vector<ScannerValue>> params) noexcept;
 };
 
 struct Registries {
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+
+#include "columns.hpp"
+#include "duckdb_extension_api.hpp"
+#include "prefetch.hpp"
+#include "query_context.hpp"
+
+namespace odbcscanner {
+
+// Reads the result set of an executed statement into DuckDB vectors,
+// shared between the table functions.
+struct ResultFetch {
+	// Binds columns if enabled by quirks, enables block fetch when
+	// all the columns can be bound
+	static void BindColumns(QueryContext &ctx, std::vector<ResultColumn> &columns);
+
+	// Fetches next rows into the specified vectors (one vector for each column),
+	// returns the number of fetched rows. When the result set is exhausted the
+	// cursor is closed and the 'exhausted' flag is set. When the prefetcher is
+	// specified, rows are taken from the rowsets fetched in background.
+	static idx_t FetchChunk(QueryContext &ctx, std::vector<ResultColumn> &columns,
+	                        std::vector<duckdb_vector> &col_vectors, bool &exhausted,
+	                        Prefetcher *prefetcher = nullptr);
+
+	// Cancels the remote execution of the statement which result set is not going to
+	// be read to the end and closes its cursor, so the server stops producing rows and
+	// releases its resources without draining the rest of the results. Prefetcher is
+	// stopped after the cancel call. Errors are ignored.
+	static void Abandon(QueryContext &ctx, std::unique_ptr<Prefetcher> &prefetcher) noexcept;
+};
+
+} // namespace odbcscanner
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 
@@ -20,4 +21,14 @@ public:
 	}
 };
 
+// Thrown when the query is running longer than the timeout specified for it
+class QueryTimeoutException : public ScannerException {
+public:
+	QueryTimeoutException(uint32_t timeout_seconds, const std::string &query, const std::string &cause = "")
+	    : ScannerException("'odbc_query' error: query timeout expired, timeout seconds: " +
+	                       std::to_string(timeout_seconds) + ", query: '" + query + "'" +
+	                       (cause.empty() ? "" : ", error: " + cause)) {
+	}
+};
+
 } // namespace odbcscanner
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "columns.hpp"
+#include "dbms_quirks.hpp"
+#include "odbc_api.hpp"
+
+namespace odbcscanner {
+
+// Prepared statement along with its result and parameters metadata
+struct CachedStatement {
+	StmtHandlePtr hstmt_ptr;
+	std::vector<ResultColumn> columns;
+	std::vector<SQLSMALLINT> param_types;
+	// statement was executed and its result columns were checked against the described ones
+	bool columns_checked = false;
+
+	CachedStatement() : hstmt_ptr(nullptr, StmtHandleDeleter()) {
+	}
+
+	CachedStatement(StmtHandlePtr hstmt_ptr_in, std::vector<ResultColumn> columns_in,
+	                std::vector<SQLSMALLINT> param_types_in, bool columns_checked_in)
+	    : hstmt_ptr(std::move(hstmt_ptr_in)), columns(std::move(columns_in)),
+	      param_types(std::move(param_types_in)), columns_checked(columns_checked_in) {
+	}
+
+	CachedStatement(const CachedStatement &other) = delete;
+	CachedStatement(CachedStatement &&other) = default;
+
+	CachedStatement &operator=(const CachedStatement &other) = delete;
+	CachedStatement &operator=(CachedStatement &&other) = default;
+};
+
+// LRU cache of prepared statements of a single connection, allows repeated
+// calls of the same query to skip the prepare and describe round trips.
+// Statements are taken out of the cache while they are used, so the same
+// statement handle is never shared between function calls.
+// Cache is invalidated when the schema may have been changed, statements
+// taken out before the invalidation are not accepted back.
+// Cache is shared by the calls that use the same connection concurrently.
+class StatementCache {
+	std::mutex mutex;
+	size_t capacity;
+	uint64_t generation = 0;
+	// most recently used entry first
+	std::list<std::pair<std::string, CachedStatement>> entries;
+	std::multimap<std::string, std::list<std::pair<std::string, CachedStatement>>::iterator> index;
+
+public:
+	static const size_t DEFAULT_CAPACITY = 32;
+
+	explicit StatementCache(size_t capacity_in = DEFAULT_CAPACITY) : capacity(capacity_in) {
+	}
+
+	StatementCache(const StatementCache &other) = delete;
+	StatementCache(StatementCache &&other) = delete;
+
+	StatementCache &operator=(const StatementCache &other) = delete;
+	StatementCache &operator=(StatementCache &&other) = delete;
+
+	static std::string Key(const std::string &query, const DbmsQuirks &quirks);
+
+	// Returns false if there is no cached statement for the specified key
+	bool Take(const std::string &key, CachedStatement &stmt_out);
+
+	// Cursor of the statement is closed, its bindings are reset
+	void Put(const std::string &key, uint64_t stmt_generation, CachedStatement stmt);
+
+	uint64_t Generation() {
+		std::lock_guard<std::mutex> guard(mutex);
+		return generation;
+	}
+
+	void Invalidate();
+};
+
+} // namespace odbcscanner
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "odbc_api.hpp"
+
+namespace odbcscanner {
+
+// Idle statement handles of a single connection, allows the short calls to skip
+// the statement allocation that requires a server round trip with some drivers.
+// Statements are returned to the pool when their handle pointers are destroyed,
+// the cursor, column bindings, parameters and the attributes set by the scanner
+// are reset before the statement is reused.
+// Pool is shared with the handle pointers, statements returned after the connection
+// is closed are freed.
+class StatementPool : public std::enable_shared_from_this<StatementPool> {
+	std::mutex mutex;
+	SQLHDBC dbc;
+	size_t capacity;
+	std::vector<HSTMT> idle;
+	bool closed = false;
+
+	// handles that were handed out and were not returned yet
+	uint64_t in_use_count = 0;
+
+public:
+	static const size_t DEFAULT_CAPACITY = 16;
+
+	explicit StatementPool(SQLHDBC dbc_in, size_t capacity_in = DEFAULT_CAPACITY) : dbc(dbc_in), capacity(capacity_in) {
+	}
+
+	StatementPool(const StatementPool &other) = delete;
+	StatementPool(StatementPool &&other) = delete;
+
+	StatementPool &operator=(const StatementPool &other) = delete;
+	StatementPool &operator=(StatementPool &&other) = delete;
+
+	// Takes an idle statement or allocates a new one, returns the 'SQLAllocHandle' result
+	SQLRETURN Alloc(StmtHandlePtr &hstmt_out);
+
+	void Recycle(HSTMT hstmt) noexcept;
+
+	// Frees the idle statements, must be called before the connection is closed,
+	// returns the number of statements that are still in use and are leaked
+	uint64_t Close() noexcept;
+
+	uint64_t InUseCount();
+};
+
+} // namespace odbcscanner
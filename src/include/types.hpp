@@ -19,12 +19,16 @@ struct OdbcType {
 	std::string desc_type_name;
 	uint8_t decimal_precision;
 	uint8_t decimal_scale;
+	// declared length of character columns in characters and in bytes, 0 when not known
+	SQLLEN desc_length;
+	SQLLEN desc_octet_length;
 
 	explicit OdbcType(SQLLEN desc_type_in, SQLLEN desc_concise_type_in, bool is_unsigned_in,
-	                  std::string desc_type_name_in, uint8_t decimal_precision_in, uint8_t decimal_scale_in)
+	                  std::string desc_type_name_in, uint8_t decimal_precision_in, uint8_t decimal_scale_in,
+	                  SQLLEN desc_length_in, SQLLEN desc_octet_length_in)
 	    : desc_type(desc_type_in), desc_concise_type(desc_concise_type_in), is_unsigned(is_unsigned_in),
 	      desc_type_name(std::move(desc_type_name_in)), decimal_precision(decimal_precision_in),
-	      decimal_scale(decimal_scale_in) {
+	      decimal_scale(decimal_scale_in), desc_length(desc_length_in), desc_octet_length(desc_octet_length_in) {
 	}
 
 	OdbcType(OdbcType &other) = delete;
@@ -74,8 +78,7 @@ struct Types {
 
 	static void BindColumn(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx);
 
-	static void FetchAndSetResult(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
-	                              idx_t row_idx);
+	static FetchKernel ResolveFetchKernel(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx);
 
 	static void CoalesceParameterType(QueryContext &ctx, ScannerValue &param);
 
@@ -90,6 +93,18 @@ struct Types {
 
 	static void SetNullValueToResult(duckdb_vector vec, idx_t row_idx);
 
+	// Sets NULLs for all the rows that have SQL_NULL_DATA indicators, 64 rows at a time
+	static void SetNullsFromIndicators(duckdb_vector vec, const SQLLEN *inds, idx_t rows_count);
+
+	// Strings up to this length are stored inline in the vector without using its string heap
+	static const size_t STRING_INLINE_LENGTH = 12;
+
+	// Returns the zeroed inline storage of the string in the vector, the caller must write
+	// at most STRING_INLINE_LENGTH bytes into it and set the string length
+	static duckdb_string_t &GetInlineStringResult(duckdb_vector vec, idx_t row_idx);
+
+	static void SetStringValueToResult(duckdb_vector vec, idx_t row_idx, const char *data, size_t len);
+
 	static std::string ToString(duckdb_type type_id);
 
 	static duckdb_type FromString(const std::string &type_name);
@@ -114,8 +129,90 @@ class TypeSpecific {
 	static void FetchAndSetResult(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
 	                              idx_t row_idx);
 
+	template <typename T>
+	static void FetchAndSetRows(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
+	                            idx_t rows_count) {
+		if (!ctx.quirks.enable_columns_binding || !ctx.BindForColumn(col_idx).IsBound()) {
+			for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+				FetchAndSetResult<T>(ctx, odbc_type, col_idx, vec, row_idx);
+			}
+			return;
+		}
+		// NULLs are set in bulk, then the whole rowset is converted without per-cell dispatch
+		ColumnBind &bind = ctx.BindForColumn(col_idx);
+		Types::SetNullsFromIndicators(vec, &bind.Indicator(), rows_count);
+		SetBoundRows<T>(ctx, odbc_type, col_idx, bind, vec, rows_count);
+	}
+
+	// Bound values have the same layout as the vector values, NULL rows are copied too,
+	// they are masked by the validity set above
+	template <typename T>
+	static void SetBoundRows(QueryContext &, OdbcType &, SQLSMALLINT, ColumnBind &bind, duckdb_vector vec,
+	                         idx_t rows_count) {
+		T *data = reinterpret_cast<T *>(duckdb_vector_get_data(vec));
+		T *bound = &bind.Value<T>();
+		for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+			data[row_idx] = bound[row_idx];
+		}
+	}
+
+	// For the types which bound layout differs from the vector one
+	template <typename T>
+	static void SetBoundRowsPerCell(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, ColumnBind &bind,
+	                                duckdb_vector vec, idx_t rows_count) {
+		for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+			if (bind.Indicator(row_idx) != SQL_NULL_DATA) {
+				FetchAndSetResult<T>(ctx, odbc_type, col_idx, vec, row_idx);
+			}
+		}
+	}
+
+	template <typename T>
+	static FetchKernel CreateFetchKernel() {
+		FetchKernel kernel;
+		kernel.fetch_value = &FetchAndSetResult<T>;
+		kernel.fetch_rows = &FetchAndSetRows<T>;
+		return kernel;
+	}
+
 	template <typename T>
 	static duckdb_type ResolveColumnType(QueryContext &ctx, ResultColumn &column);
 };
 
+// Bound values that cannot be copied as-is
+
+template <>
+void TypeSpecific::SetBoundRows<bool>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, ColumnBind &bind,
+                                      duckdb_vector vec, idx_t rows_count);
+
+template <>
+void TypeSpecific::SetBoundRows<std::string>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                             ColumnBind &bind, duckdb_vector vec, idx_t rows_count);
+
+template <>
+void TypeSpecific::SetBoundRows<duckdb_blob>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                             ColumnBind &bind, duckdb_vector vec, idx_t rows_count);
+
+template <>
+void TypeSpecific::SetBoundRows<ScannerUuid>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                             ColumnBind &bind, duckdb_vector vec, idx_t rows_count);
+
+// Decimal and temporal values are converted from the whole bound rowset at once
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_decimal>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                   duckdb_vector vec, idx_t rows_count);
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_date_struct>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                       duckdb_vector vec, idx_t rows_count);
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_time_struct>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                       duckdb_vector vec, idx_t rows_count);
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_timestamp_struct>(QueryContext &ctx, OdbcType &odbc_type,
+                                                            SQLSMALLINT col_idx, duckdb_vector vec, idx_t rows_count);
+
 } // namespace odbcscanner
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "odbc_api.hpp"
+
+namespace odbcscanner {
+
+// Cancels the statements that are running longer than their timeout, calling
+// SQLCancel from a background thread. Used along with SQL_ATTR_QUERY_TIMEOUT
+// for the drivers that do not support it or that do not apply it to fetching,
+// a blocked SQLExecute or SQLFetch call returns with an error after the cancel.
+// Cancel is a no-op when no call is running on the statement, so the callers
+// must also check Expired() before every execute and fetch call.
+class WatchdogTimer {
+	uint64_t watch_id = 0;
+	uint32_t timeout_seconds = 0;
+	std::chrono::steady_clock::time_point deadline;
+
+public:
+	// Starts watching the statement, the timer must be destroyed before the statement is freed
+	WatchdogTimer(HSTMT hstmt, uint32_t timeout_seconds_in);
+
+	~WatchdogTimer() noexcept;
+
+	WatchdogTimer(const WatchdogTimer &other) = delete;
+	WatchdogTimer(WatchdogTimer &&other) = delete;
+
+	WatchdogTimer &operator=(const WatchdogTimer &other) = delete;
+	WatchdogTimer &operator=(WatchdogTimer &&other) = delete;
+
+	// Returns true if the deadline of the statement is passed, whether
+	// or not the statement was already canceled by the watchdog
+	bool Expired();
+
+	uint32_t TimeoutSeconds() {
+		return timeout_seconds;
+	}
+};
+
+} // namespace odbcscanner
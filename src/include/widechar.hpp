@@ -34,9 +34,26 @@ struct WideString {
 };
 
 struct WideChar {
+	// Output buffers of the '*To' functions must have a capacity of at least
+	// 'in_buf_len * MAX_UTF8_BYTES_PER_UNIT' bytes
+	static const size_t MAX_UTF8_BYTES_PER_UNIT = 3;
+
 	static std::string Narrow(const SQLWCHAR *in_buf, size_t in_buf_len, const SQLWCHAR **first_invalid_char = nullptr);
 
+	// Returns the number of bytes written
+	static size_t NarrowTo(const SQLWCHAR *in_buf, size_t in_buf_len, char *out_buf,
+	                       const SQLWCHAR **first_invalid_char = nullptr);
+
 	static WideString Widen(const char *in_buf, size_t in_buf_len, const char **first_invalid_char = nullptr);
+
+	// Copies UTF-8 data as is, invalid sequences are replaced with U+FFFD
+	static std::string ValidateUtf8(const char *in_buf, size_t in_buf_len, const char **first_invalid_char = nullptr);
+
+	// Returns nullptr when the data is valid UTF-8
+	static const char *FindInvalidUtf8(const char *in_buf, size_t in_buf_len);
+
+	// Returns the number of bytes written
+	static size_t ReplaceInvalidUtf8To(const char *in_buf, size_t in_buf_len, char *out_buf);
 };
 
 } // namespace odbcscanner
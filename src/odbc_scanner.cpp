@@ -17,12 +17,14 @@ static void Initialize(duckdb_connection connection, duckdb_extension_info, duck
 	OdbcCloseFunction::Register(connection);
 	OdbcCommitFunction::Register(connection);
 	OdbcConnectFunction::Register(connection);
+	OdbcConnectManyFunction::Register(connection);
 	OdbcCopyFunction::Register(connection);
 	OdbcCreateParamsFunction::Register(connection);
 	OdbcListDataSourcesFunction::Register(connection);
 	OdbcListDriversFunction::Register(connection);
 	OdbcQueryFunction::Register(connection);
 	OdbcRollbackFunction::Register(connection);
+	OdbcScanFunction::Register(connection);
 }
 
 } // namespace odbcscanner
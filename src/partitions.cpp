@@ -0,0 +1,284 @@
+#include "partitions.hpp"
+
+#include <algorithm>
+
+#include "capi_pointers.hpp"
+#include "diagnostics.hpp"
+#include "params.hpp"
+#include "scanner_exception.hpp"
+#include "strings.hpp"
+
+DUCKDB_EXTENSION_EXTERN
+
+namespace odbcscanner {
+
+static std::string ExtractVarchar(duckdb_bind_info info, const std::string &name) {
+	auto val = ValuePtr(duckdb_bind_get_named_parameter(info, name.c_str()), ValueDeleter);
+	if (val.get() == nullptr || duckdb_is_null_value(val.get())) {
+		return std::string();
+	}
+	auto cstr = VarcharPtr(duckdb_get_varchar(val.get()), VarcharDeleter);
+	return std::string(cstr.get());
+}
+
+PartitionOptions Partitions::ExtractOptions(duckdb_bind_info info) {
+	std::string column = Strings::Trim(ExtractVarchar(info, "partition_column"));
+
+	uint32_t count = 0;
+	auto count_val = ValuePtr(duckdb_bind_get_named_parameter(info, "partition_count"), ValueDeleter);
+	if (count_val.get() != nullptr && !duckdb_is_null_value(count_val.get())) {
+		count = duckdb_get_uint32(count_val.get());
+	}
+
+	PartitionStrategy strategy = PartitionStrategy::RANGE;
+	std::string strategy_name = Strings::ToUpper(Strings::Trim(ExtractVarchar(info, "partition_strategy")));
+	if (strategy_name == "QUANTILE") {
+		strategy = PartitionStrategy::QUANTILE;
+	} else if (strategy_name == "MODULO") {
+		strategy = PartitionStrategy::MODULO;
+	} else if (!strategy_name.empty() && strategy_name != "RANGE") {
+		throw ScannerException("'odbc_query' error: invalid 'partition_strategy' specified: '" + strategy_name +
+		                       "', supported strategies: 'range', 'quantile', 'modulo'");
+	}
+
+	if (count > 1 && column.empty()) {
+		throw ScannerException("'odbc_query' error: 'partition_column' must be specified along with "
+		                       "'partition_count'");
+	}
+	if (!column.empty() && count == 0) {
+		throw ScannerException("'odbc_query' error: 'partition_count' must be specified along with "
+		                       "'partition_column'");
+	}
+
+	return PartitionOptions(column, count, strategy);
+}
+
+static std::string TrimQuery(const std::string &query) {
+	std::string res = Strings::Trim(query);
+	while (res.length() > 0 && res.back() == ';') {
+		res.pop_back();
+		res = Strings::Trim(res);
+	}
+	return res;
+}
+
+static std::string WrapQuery(const std::string &query, const std::string &predicate) {
+	return "SELECT * FROM (" + TrimQuery(query) + ") odbc_scanner_partition WHERE " + predicate;
+}
+
+uint64_t PartitionRange::Width() const {
+	if (!predicate.empty() || upper <= lower) {
+		return 0;
+	}
+	// Unsigned arithmetic is used to not overflow on the full BIGINT domain
+	return static_cast<uint64_t>(upper) - static_cast<uint64_t>(lower);
+}
+
+std::string PartitionRange::Query(const std::string &query, const std::string &column) const {
+	if (!predicate.empty()) {
+		return WrapQuery(query, predicate);
+	}
+	if (first && last) {
+		return query;
+	}
+	if (first) {
+		return WrapQuery(query, column + " < " + std::to_string(upper) + " OR " + column + " IS NULL");
+	}
+	if (last) {
+		return WrapQuery(query, column + " >= " + std::to_string(lower));
+	}
+	return WrapQuery(query, column + " >= " + std::to_string(lower) + " AND " + column + " < " +
+	                            std::to_string(upper));
+}
+
+PartitionQueue::PartitionQueue(std::vector<PartitionRange> ranges_in, size_t workers_count_in)
+    : ranges(ranges_in.begin(), ranges_in.end()), workers_count(workers_count_in) {
+}
+
+bool PartitionQueue::Pull(PartitionRange &range_out) {
+	std::lock_guard<std::mutex> guard(mutex);
+	if (ranges.empty()) {
+		return false;
+	}
+
+	if (ranges.size() < workers_count) {
+		auto widest = ranges.end();
+		for (auto it = ranges.begin(); it != ranges.end(); ++it) {
+			if (it->Width() >= 2 && (widest == ranges.end() || it->Width() > widest->Width())) {
+				widest = it;
+			}
+		}
+		if (widest != ranges.end()) {
+			PartitionRange &range = *widest;
+			int64_t mid = static_cast<int64_t>(static_cast<uint64_t>(range.lower) + range.Width() / 2);
+			PartitionRange tail(mid, range.upper, false, range.last);
+			range.upper = mid;
+			range.last = false;
+			ranges.insert(widest + 1, std::move(tail));
+		}
+	}
+
+	range_out = std::move(ranges.front());
+	ranges.pop_front();
+	return true;
+}
+
+static std::pair<int64_t, bool> FetchBigint(QueryContext &ctx, SQLUSMALLINT col_idx) {
+	int64_t fetched = 0;
+	SQLLEN ind = 0;
+	SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_SBIGINT, &fetched, sizeof(fetched), &ind);
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLGetData' failed, C type: " + std::to_string(SQL_C_SBIGINT) + ", column index: " +
+		                       std::to_string(col_idx) + ",  query: '" + ctx.query + "', return: " +
+		                       std::to_string(ret) + ", diagnostics: '" + diag + "'");
+	}
+	return std::make_pair(fetched, ind == SQL_NULL_DATA);
+}
+
+// Runs the specified query that returns pairs of MIN and MAX key values,
+// rows with NULL values are skipped
+static std::vector<std::pair<int64_t, int64_t>> QueryBoundaries(OdbcConnection &conn, QueryContext &ctx,
+                                                                std::vector<ScannerValue> &params,
+                                                                const std::string &query) {
+	QueryContext bctx = QueryContext::Prepare(conn, query, ctx.quirks);
+
+	Params::BindToOdbc(bctx, params);
+
+	{
+		SQLRETURN ret = SQLExecute(bctx.hstmt());
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(bctx.hstmt(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLExecute' failed, query: '" + query + "', return: " + std::to_string(ret) +
+			                       ", diagnostics: '" + diag + "'");
+		}
+	}
+
+	std::vector<std::pair<int64_t, int64_t>> res;
+	for (;;) {
+		SQLRETURN ret = SQLFetch(bctx.hstmt());
+		if (ret == SQL_NO_DATA) {
+			break;
+		}
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(bctx.hstmt(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLFetch' failed, query: '" + query + "', return: " + std::to_string(ret) +
+			                       ", diagnostics: '" + diag + "'");
+		}
+		auto min_fetched = FetchBigint(bctx, 1);
+		auto max_fetched = FetchBigint(bctx, 2);
+		if (!min_fetched.second && !max_fetched.second) {
+			res.emplace_back(min_fetched.first, max_fetched.first);
+		}
+	}
+	return res;
+}
+
+// Creates ranges from sorted unique lower boundaries, the first boundary is the minimal key
+static std::vector<PartitionRange> RangesFromBoundaries(const std::vector<int64_t> &bounds, int64_t max) {
+	std::vector<PartitionRange> res;
+	for (size_t i = 0; i < bounds.size(); i++) {
+		bool first = i == 0;
+		bool last = i == bounds.size() - 1;
+		int64_t upper = last ? max : bounds.at(i + 1);
+		res.emplace_back(bounds.at(i), upper, first, last);
+	}
+	return res;
+}
+
+static std::vector<PartitionRange> CreateEqualRanges(OdbcConnection &conn, QueryContext &ctx,
+                                                     std::vector<ScannerValue> &params,
+                                                     const PartitionOptions &options) {
+	const std::string &col = options.column;
+	std::string query =
+	    "SELECT MIN(" + col + "), MAX(" + col + ") FROM (" + TrimQuery(ctx.query) + ") odbc_scanner_partition";
+	auto min_max = QueryBoundaries(conn, ctx, params, query);
+	if (min_max.empty()) {
+		std::vector<PartitionRange> res;
+		res.emplace_back(0, 0, true, true);
+		return res;
+	}
+	int64_t min = min_max.at(0).first;
+	int64_t max = min_max.at(0).second;
+
+	uint64_t span = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+	uint64_t parts = static_cast<uint64_t>(options.count) * PartitionOptions::RANGES_PER_WORKER;
+	if (span < parts) {
+		parts = span + 1;
+	}
+	uint64_t step = span / parts + 1;
+
+	std::vector<int64_t> bounds;
+	bounds.push_back(min);
+	for (uint64_t i = 1; i < parts; i++) {
+		uint64_t offset = i * step;
+		if (offset > span) {
+			break;
+		}
+		bounds.push_back(static_cast<int64_t>(static_cast<uint64_t>(min) + offset));
+	}
+	return RangesFromBoundaries(bounds, max);
+}
+
+static std::vector<PartitionRange> CreateQuantileRanges(OdbcConnection &conn, QueryContext &ctx,
+                                                        std::vector<ScannerValue> &params,
+                                                        const PartitionOptions &options) {
+	const std::string &col = options.column;
+	uint64_t tiles = static_cast<uint64_t>(options.count) * PartitionOptions::RANGES_PER_WORKER;
+	std::string query = "SELECT MIN(odbc_scanner_key), MAX(odbc_scanner_key) FROM (SELECT " + col +
+	                    " AS odbc_scanner_key, NTILE(" + std::to_string(tiles) + ") OVER (ORDER BY " + col +
+	                    ") AS odbc_scanner_tile FROM (" + TrimQuery(ctx.query) + ") odbc_scanner_partition WHERE " +
+	                    col + " IS NOT NULL) odbc_scanner_tiles GROUP BY odbc_scanner_tile";
+	auto min_max = QueryBoundaries(conn, ctx, params, query);
+	if (min_max.empty()) {
+		std::vector<PartitionRange> res;
+		res.emplace_back(0, 0, true, true);
+		return res;
+	}
+
+	// The same key can span multiple tiles, boundaries are de-duplicated
+	std::vector<int64_t> bounds;
+	int64_t max = min_max.at(0).second;
+	for (auto &pa : min_max) {
+		bounds.push_back(pa.first);
+		max = std::max(max, pa.second);
+	}
+	std::sort(bounds.begin(), bounds.end());
+	bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+	return RangesFromBoundaries(bounds, max);
+}
+
+static std::vector<PartitionRange> CreateModuloRanges(OdbcConnection &conn, const PartitionOptions &options) {
+	std::vector<PartitionRange> res;
+	const std::string &col = options.column;
+	std::string count_str = std::to_string(options.count);
+	std::string mod_expr = "MOD(" + col + ", " + count_str + ")";
+	if (conn.driver == DbmsDriver::MSSQL) {
+		mod_expr = "(" + col + " % " + count_str + ")";
+	}
+	for (uint32_t i = 0; i < options.count; i++) {
+		std::string predicate = "ABS(" + mod_expr + ") = " + std::to_string(i);
+		if (i == 0) {
+			predicate += " OR " + col + " IS NULL";
+		}
+		res.emplace_back(predicate);
+	}
+	return res;
+}
+
+std::vector<PartitionRange> Partitions::CreateRanges(OdbcConnection &conn, QueryContext &ctx,
+                                                     std::vector<ScannerValue> &params,
+                                                     const PartitionOptions &options) {
+	switch (options.strategy) {
+	case PartitionStrategy::RANGE:
+		return CreateEqualRanges(conn, ctx, params, options);
+	case PartitionStrategy::QUANTILE:
+		return CreateQuantileRanges(conn, ctx, params, options);
+	case PartitionStrategy::MODULO:
+		return CreateModuloRanges(conn, options);
+	default:
+		throw ScannerException("Unsupported partition strategy, query: '" + ctx.query + "'");
+	}
+}
+
+} // namespace odbcscanner
@@ -0,0 +1,198 @@
+#include "prefetch.hpp"
+
+#include <cstdint>
+
+#include "diagnostics.hpp"
+#include "make_unique.hpp"
+#include "scanner_exception.hpp"
+
+namespace odbcscanner {
+
+static const size_t NO_ROWSET = static_cast<size_t>(-1);
+
+Prefetcher::Prefetcher(QueryContext &ctx, size_t rowsets_count)
+    : hstmt(ctx.hstmt()), query(ctx.query), watchdog_timer(ctx.watchdog_timer.get()), current_idx(NO_ROWSET) {
+	for (size_t i = 0; i < rowsets_count; i++) {
+		Rowset rowset;
+		for (ColumnBind &bind : ctx.col_binds) {
+			rowset.col_binds.emplace_back(ColumnBind::CreateSameLayout(bind, ctx.rowset_size));
+		}
+		rowset.row_statuses.resize(ctx.rowset_size);
+		rowsets.emplace_back(std::move(rowset));
+		free_idxs.push_back(i);
+	}
+	// columns are re-bound to the staging buffers before every fetch,
+	// the context only holds the buffers of the rowset being converted
+	ctx.col_binds.clear();
+	thread = std::thread([this] { Run(); });
+}
+
+Prefetcher::~Prefetcher() noexcept {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		stop = true;
+	}
+	cv.notify_all();
+	// fetch call that is already running is waited for
+	if (thread.joinable()) {
+		thread.join();
+	}
+	// statement must not refer to the staging buffers after they are freed
+	SQLFreeStmt(hstmt, SQL_UNBIND);
+	SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+	SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+}
+
+std::unique_ptr<Prefetcher> Prefetcher::Start(QueryContext &ctx) {
+	if (!ctx.quirks.enable_prefetch || ctx.rowset_size <= 1) {
+		return std::unique_ptr<Prefetcher>();
+	}
+	uint64_t rowset_bytes = static_cast<uint64_t>(ctx.rowset_size * sizeof(SQLUSMALLINT));
+	for (ColumnBind &bind : ctx.col_binds) {
+		// values of variable-length columns that do not fit into the bound buffers
+		// are read with SQLGetData that requires the cursor to stay on the rowset
+		if (!bind.IsBound() || bind.IsVarLen()) {
+			return std::unique_ptr<Prefetcher>();
+		}
+		rowset_bytes += static_cast<uint64_t>(bind.value_size) * ctx.rowset_size;
+		rowset_bytes += static_cast<uint64_t>(ctx.rowset_size * sizeof(SQLLEN));
+	}
+	uint64_t rowsets_count = ctx.quirks.prefetch_memory_limit_bytes / rowset_bytes;
+	if (rowsets_count < 2) {
+		return std::unique_ptr<Prefetcher>();
+	}
+	if (rowsets_count > MAX_ROWSETS) {
+		rowsets_count = MAX_ROWSETS;
+	}
+	return std_make_unique<Prefetcher>(ctx, static_cast<size_t>(rowsets_count));
+}
+
+// Runs in the background thread, errors are reported to the caller of Next()
+bool Prefetcher::FetchRowset(Rowset &rowset) {
+	for (size_t col_idxz = 0; col_idxz < rowset.col_binds.size(); col_idxz++) {
+		ColumnBind &bind = rowset.col_binds.at(col_idxz);
+		SQLUSMALLINT col_idx = static_cast<SQLUSMALLINT>(col_idxz + 1);
+		SQLRETURN ret = SQLBindCol(hstmt, col_idx, bind.ctype, bind.values.data(), bind.value_size, bind.inds.data());
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(hstmt, SQL_HANDLE_STMT);
+			error = "'SQLBindCol' failed for prefetch, C type: " + std::to_string(bind.ctype) +
+			        ", column index: " + std::to_string(col_idx) + ", query: '" + query +
+			        "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'";
+			return false;
+		}
+	}
+	{
+		SQLRETURN ret = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, rowset.row_statuses.data(), 0);
+		if (SQL_SUCCEEDED(ret)) {
+			ret = SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &rowset.rows_fetched, 0);
+		}
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(hstmt, SQL_HANDLE_STMT);
+			error = "'SQLSetStmtAttr' failed for prefetch, query: '" + query + "', return: " + std::to_string(ret) +
+			        ", diagnostics: '" + diag + "'";
+			return false;
+		}
+	}
+
+	// cancel of the expired statement is a no-op between the fetch calls
+	if (watchdog_timer != nullptr && watchdog_timer->Expired()) {
+		timed_out = true;
+		return false;
+	}
+
+	rowset.rows_fetched = 0;
+	SQLRETURN ret = SQLFetch(hstmt);
+	if (ret == SQL_NO_DATA) {
+		SQLFreeStmt(hstmt, SQL_CLOSE);
+		return false;
+	}
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(hstmt, SQL_HANDLE_STMT);
+		error = "'SQLFetch' failed, query: '" + query + "', return: " + std::to_string(ret) + ", diagnostics: '" +
+		        diag + "'";
+		return false;
+	}
+	if (rowset.rows_fetched > rowset.row_statuses.size()) {
+		error = "Invalid number of rows fetched: " + std::to_string(rowset.rows_fetched) +
+		        ", rowset size: " + std::to_string(rowset.row_statuses.size()) + ", query: '" + query + "'";
+		return false;
+	}
+	for (SQLULEN row_idx = 0; row_idx < rowset.rows_fetched; row_idx++) {
+		if (rowset.row_statuses.at(row_idx) == SQL_ROW_ERROR) {
+			std::string diag = Diagnostics::Read(hstmt, SQL_HANDLE_STMT);
+			error = "'SQLFetch' failed for rowset row, row index: " + std::to_string(row_idx) + ", query: '" + query +
+			        "', diagnostics: '" + diag + "'";
+			return false;
+		}
+	}
+	return true;
+}
+
+void Prefetcher::Run() {
+	for (;;) {
+		size_t idx = NO_ROWSET;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cv.wait(lock, [this] { return stop || free_idxs.size() > 0; });
+			if (stop) {
+				return;
+			}
+			idx = free_idxs.front();
+			free_idxs.pop_front();
+		}
+
+		bool fetched = FetchRowset(rowsets.at(idx));
+
+		{
+			std::lock_guard<std::mutex> guard(mutex);
+			if (fetched) {
+				ready_idxs.push_back(idx);
+			} else {
+				done = true;
+			}
+		}
+		cv.notify_all();
+
+		if (!fetched) {
+			return;
+		}
+	}
+}
+
+bool Prefetcher::Next(QueryContext &ctx) {
+	std::unique_lock<std::mutex> lock(mutex);
+	cv.wait(lock, [this] { return done || ready_idxs.size() > 0; });
+	if (ready_idxs.size() == 0) {
+		if (timed_out) {
+			throw QueryTimeoutException(watchdog_timer->TimeoutSeconds(), query);
+		}
+		if (!error.empty()) {
+			throw ScannerException(error);
+		}
+		return false;
+	}
+	current_idx = ready_idxs.front();
+	ready_idxs.pop_front();
+	Rowset &rowset = rowsets.at(current_idx);
+	ctx.col_binds.swap(rowset.col_binds);
+	ctx.row_statuses.swap(rowset.row_statuses);
+	ctx.rows_fetched = rowset.rows_fetched;
+	return true;
+}
+
+void Prefetcher::Release(QueryContext &ctx) {
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		if (current_idx == NO_ROWSET) {
+			return;
+		}
+		Rowset &rowset = rowsets.at(current_idx);
+		ctx.col_binds.swap(rowset.col_binds);
+		ctx.row_statuses.swap(rowset.row_statuses);
+		free_idxs.push_back(current_idx);
+		current_idx = NO_ROWSET;
+	}
+	cv.notify_all();
+}
+
+} // namespace odbcscanner
@@ -0,0 +1,30 @@
+#include "query_context.hpp"
+
+#include "diagnostics.hpp"
+#include "scanner_exception.hpp"
+#include "statement_pool.hpp"
+#include "widechar.hpp"
+
+namespace odbcscanner {
+
+QueryContext QueryContext::Prepare(OdbcConnection &conn, std::string query, DbmsQuirks quirks) {
+	StmtHandlePtr hstmt(nullptr, StmtHandleDeleter());
+	{
+		SQLRETURN ret = conn.stmt_pool->Alloc(hstmt);
+		if (!SQL_SUCCEEDED(ret)) {
+			throw ScannerException("'SQLAllocHandle' failed for STMT handle, return: " + std::to_string(ret));
+		}
+	}
+	{
+		auto wquery = WideChar::Widen(query.data(), query.length());
+		SQLRETURN ret = SQLPrepareW(hstmt.get(), wquery.data(), wquery.length<SQLINTEGER>());
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(hstmt.get(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLPrepare' failed, query: '" + query + "', return: " + std::to_string(ret) +
+			                       ", diagnostics: '" + diag + "'");
+		}
+	}
+	return QueryContext(std::move(query), std::move(hstmt), std::move(quirks));
+}
+
+} // namespace odbcscanner
@@ -1,136 +1,324 @@
 #include "registries.hpp"
 
+#include <atomic>
 #include <mutex>
-#include <set>
 
+#include "connection_scheduler.hpp"
 #include "scanner_exception.hpp"
 
 namespace odbcscanner {
 
-// initialized from DUCKDB_EXTENSION_ENTRYPOINT
-static std::shared_ptr<std::mutex> SharedMutex() {
-	static auto mutex = std::make_shared<std::mutex>();
-	return mutex;
-}
+namespace {
+
+// Registry is split into shards, every shard has its own lock, so the calls that use
+// different objects are rarely waiting for each other. Handle ID includes the shard
+// and slot indices, so the object is found without searching:
+// bits 0-3: shard, bits 4-31: slot, bits 32-62: slot generation.
+template <typename T>
+class HandleTable {
+	static const size_t SHARDS_COUNT = 16;
+	static const uint64_t SHARD_BITS = 4;
+	static const uint64_t SLOT_BITS = 28;
+	static const uint32_t MAX_GENERATION = 0x7FFFFFFF;
+
+	struct Slot {
+		T *ptr = nullptr;
+		uint32_t generation = 1;
+		bool used = false;
+		bool taken = false;
+		// object is deleted when its last lease is ended
+		bool removed = false;
+		uint32_t leases = 0;
+	};
+
+	struct Shard {
+		std::mutex mutex;
+		std::vector<Slot> slots;
+		std::vector<uint32_t> free_slots;
+	};
+
+	const char *name;
+	bool delete_on_exit;
+	Shard shards[SHARDS_COUNT];
+	std::atomic<uint64_t> next_shard{0};
+
+	static int64_t EncodeId(size_t shard_idx, uint32_t slot_idx, uint32_t generation) {
+		uint64_t id = (static_cast<uint64_t>(generation) << (SHARD_BITS + SLOT_BITS)) |
+		              (static_cast<uint64_t>(slot_idx) << SHARD_BITS) | static_cast<uint64_t>(shard_idx);
+		return static_cast<int64_t>(id);
+	}
 
-// We are NOT closing the connection on process exit - some
-// ODBC drivers don't like it and can complain to stderr or crash
-static void SharedConectionsRegistryDeleter(std::set<int64_t> *reg_ptr) {
-	auto &reg = *reg_ptr;
-	/*
-	for (int64_t conn_id : reg) {
-	    OdbcConnection *conn_ptr = reinterpret_cast<OdbcConnection *>(conn_id);
-	    delete conn_ptr;
+	// Returns the slot that is in use and matches the generation of the ID, the shard lock must be held
+	Slot *FindSlot(Shard &shard, int64_t id) {
+		uint64_t uid = static_cast<uint64_t>(id);
+		uint64_t slot_idx = (uid >> SHARD_BITS) & ((static_cast<uint64_t>(1) << SLOT_BITS) - 1);
+		uint64_t generation = uid >> (SHARD_BITS + SLOT_BITS);
+		if (slot_idx >= shard.slots.size()) {
+			return nullptr;
+		}
+		Slot &slot = shard.slots[slot_idx];
+		if (!slot.used || slot.generation != generation) {
+			return nullptr;
+		}
+		return &slot;
 	}
-	*/
-	reg.clear();
-	delete reg_ptr;
-}
 
-// initialized from DUCKDB_EXTENSION_ENTRYPOINT
-static std::shared_ptr<std::set<int64_t>> SharedConnectionsRegistry() {
-	static auto registry = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>, SharedConectionsRegistryDeleter);
-	return registry;
-}
+	Shard &ShardOf(int64_t id) {
+		return shards[static_cast<uint64_t>(id) & (SHARDS_COUNT - 1)];
+	}
 
-static void SharedParamsRegistryDeleter(std::set<int64_t> *reg_ptr) {
-	auto &reg = *reg_ptr;
-	for (int64_t params_id : reg) {
-		std::vector<ScannerValue> *params_ptr = reinterpret_cast<std::vector<ScannerValue> *>(params_id);
-		delete params_ptr;
+	// Slot can be reused, the shard lock must be held
+	static void FreeSlot(Shard &shard, Slot &slot) {
+		slot.ptr = nullptr;
+		slot.used = false;
+		slot.taken = false;
+		slot.removed = false;
+		slot.leases = 0;
+		slot.generation = slot.generation < MAX_GENERATION ? slot.generation + 1 : 1;
+		shard.free_slots.push_back(static_cast<uint32_t>(&slot - shard.slots.data()));
 	}
-	reg.clear();
-	delete reg_ptr;
-}
 
-// initialized from DUCKDB_EXTENSION_ENTRYPOINT
-static std::shared_ptr<std::set<int64_t>> SharedParamsRegistry() {
-	static auto registry = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>, SharedParamsRegistryDeleter);
-	return registry;
-}
+public:
+	HandleTable(const char *name_in, bool delete_on_exit_in) : name(name_in), delete_on_exit(delete_on_exit_in) {
+	}
 
-int64_t ConnectionsRegistry::Add(std::unique_ptr<OdbcConnection> conn) {
-	if (conn.get() == nullptr) {
-		throw ScannerException("Cannot register invalid empty connection");
+	HandleTable(const HandleTable &other) = delete;
+	HandleTable(HandleTable &&other) = delete;
+
+	HandleTable &operator=(const HandleTable &other) = delete;
+	HandleTable &operator=(HandleTable &&other) = delete;
+
+	~HandleTable() noexcept {
+		if (!delete_on_exit) {
+			return;
+		}
+		for (Shard &shard : shards) {
+			for (Slot &slot : shard.slots) {
+				delete slot.ptr;
+			}
+		}
+	}
+
+	int64_t Add(std::unique_ptr<T> obj) {
+		if (obj.get() == nullptr) {
+			throw ScannerException(std::string("Cannot register invalid empty ") + name);
+		}
+
+		size_t shard_idx = static_cast<size_t>(next_shard.fetch_add(1, std::memory_order_relaxed) % SHARDS_COUNT);
+		Shard &shard = shards[shard_idx];
+		std::lock_guard<std::mutex> guard(shard.mutex);
+
+		uint32_t slot_idx = 0;
+		if (shard.free_slots.size() > 0) {
+			slot_idx = shard.free_slots.back();
+			shard.free_slots.pop_back();
+		} else {
+			if (shard.slots.size() >= (static_cast<uint64_t>(1) << SLOT_BITS)) {
+				throw ScannerException(std::string("Cannot register ") + name +
+				                       ", registry is full, size: " + std::to_string(shard.slots.size()));
+			}
+			slot_idx = static_cast<uint32_t>(shard.slots.size());
+			shard.slots.emplace_back();
+		}
+
+		Slot &slot = shard.slots[slot_idx];
+		slot.ptr = obj.release();
+		slot.used = true;
+		slot.taken = false;
+		return EncodeId(shard_idx, slot_idx, slot.generation);
 	}
 
-	auto mtx = SharedMutex();
-	std::lock_guard<std::mutex> guard(*mtx);
+	std::unique_ptr<T> Remove(int64_t id) {
+		Shard &shard = ShardOf(id);
+		std::lock_guard<std::mutex> guard(shard.mutex);
+		Slot *slot = FindSlot(shard, id);
+		if (slot == nullptr || slot->removed) {
+			return std::unique_ptr<T>(nullptr);
+		}
+		if (slot->leases > 0) {
+			slot->removed = true;
+			return std::unique_ptr<T>(nullptr);
+		}
+		std::unique_ptr<T> obj(slot->ptr);
+		FreeSlot(shard, *slot);
+		return obj;
+	}
+
+	std::unique_ptr<T> Take(int64_t id) {
+		Shard &shard = ShardOf(id);
+		std::lock_guard<std::mutex> guard(shard.mutex);
+		Slot *slot = FindSlot(shard, id);
+		if (slot == nullptr || slot->taken || slot->removed || slot->leases > 0) {
+			return std::unique_ptr<T>(nullptr);
+		}
+		std::unique_ptr<T> obj(slot->ptr);
+		slot->ptr = nullptr;
+		slot->taken = true;
+		return obj;
+	}
 
-	auto shared_reg_ptr = SharedConnectionsRegistry();
-	auto &shared_reg = *shared_reg_ptr;
+	// Returns false if the object was removed while it was taken out
+	bool Return(int64_t id, std::unique_ptr<T> &obj) noexcept {
+		Shard &shard = ShardOf(id);
+		std::lock_guard<std::mutex> guard(shard.mutex);
+		Slot *slot = FindSlot(shard, id);
+		if (slot == nullptr || !slot->taken) {
+			return false;
+		}
+		slot->ptr = obj.release();
+		slot->taken = false;
+		return true;
+	}
 
-	int64_t conn_id = reinterpret_cast<int64_t>(conn.get());
-	auto res = shared_reg.insert(conn_id);
-	bool inserted = res.second;
+	// Object stays in the registry while it is leased, returns nullptr if it is not found
+	T *Lease(int64_t id) {
+		Shard &shard = ShardOf(id);
+		std::lock_guard<std::mutex> guard(shard.mutex);
+		Slot *slot = FindSlot(shard, id);
+		if (slot == nullptr || slot->taken || slot->removed) {
+			return nullptr;
+		}
+		slot->leases++;
+		return slot->ptr;
+	}
 
-	if (!inserted) {
-		throw ScannerException("ODBC connection is already registered, ID: " + std::to_string(conn_id));
+	// Returns the object that was removed while it was leased when its last lease is ended
+	std::unique_ptr<T> EndLease(int64_t id) noexcept {
+		Shard &shard = ShardOf(id);
+		std::lock_guard<std::mutex> guard(shard.mutex);
+		Slot *slot = FindSlot(shard, id);
+		if (slot == nullptr || slot->leases == 0) {
+			return std::unique_ptr<T>(nullptr);
+		}
+		slot->leases--;
+		if (!slot->removed || slot->leases > 0) {
+			return std::unique_ptr<T>(nullptr);
+		}
+		std::unique_ptr<T> obj(slot->ptr);
+		FreeSlot(shard, *slot);
+		return obj;
 	}
+};
+
+} // namespace
+
+// initialized from DUCKDB_EXTENSION_ENTRYPOINT
+
+// We are NOT closing the connection on process exit - some
+// ODBC drivers don't like it and can complain to stderr or crash
+static HandleTable<OdbcConnection> &SharedConnectionsRegistry() {
+	static HandleTable<OdbcConnection> registry("connection", false);
+	return registry;
+}
 
-	conn.release();
+static HandleTable<std::vector<ScannerValue>> &SharedParamsRegistry() {
+	static HandleTable<std::vector<ScannerValue>> registry("params", true);
+	return registry;
+}
 
-	return conn_id;
+int64_t ConnectionsRegistry::Add(std::unique_ptr<OdbcConnection> conn) {
+	return SharedConnectionsRegistry().Add(std::move(conn));
 }
 
 std::unique_ptr<OdbcConnection> ConnectionsRegistry::Remove(int64_t conn_id) {
-	auto mtx = SharedMutex();
-	std::lock_guard<std::mutex> guard(*mtx);
-
-	auto shared_reg_ptr = SharedConnectionsRegistry();
-	auto &shared_reg = *shared_reg_ptr;
+	return SharedConnectionsRegistry().Remove(conn_id);
+}
 
-	auto removed_count = shared_reg.erase(conn_id);
-	if (removed_count == 0) {
-		return std::unique_ptr<OdbcConnection>(nullptr);
+ConnectionLease ConnectionsRegistry::Lease(int64_t conn_id, bool admit) {
+	OdbcConnection *conn = SharedConnectionsRegistry().Lease(conn_id);
+	if (conn == nullptr) {
+		return ConnectionLease();
+	}
+	// connection that was removed while waiting is closed when the lease is ended on timeout
+	ConnectionLease lease(conn_id, conn);
+	if (admit) {
+		lease.Admit();
 	}
+	return lease;
+}
 
-	OdbcConnection *conn_ptr = reinterpret_cast<OdbcConnection *>(conn_id);
-	return std::unique_ptr<OdbcConnection>(conn_ptr);
+ConnectionLease::ConnectionLease(ConnectionLease &&other) noexcept
+    : conn_id(other.conn_id), conn(other.conn), admitted(other.admitted) {
+	other.conn_id = -1;
+	other.conn = nullptr;
+	other.admitted = false;
 }
 
-int64_t ParamsRegistry::Add(std::unique_ptr<std::vector<ScannerValue>> params) {
-	if (params.get() == nullptr) {
-		throw ScannerException("Cannot register invalid empty params");
+ConnectionLease &ConnectionLease::operator=(ConnectionLease &&other) noexcept {
+	if (this != &other) {
+		Reset();
+		conn_id = other.conn_id;
+		conn = other.conn;
+		admitted = other.admitted;
+		other.conn_id = -1;
+		other.conn = nullptr;
+		other.admitted = false;
 	}
+	return *this;
+}
 
-	auto mtx = SharedMutex();
-	std::lock_guard<std::mutex> guard(*mtx);
-
-	auto shared_reg_ptr = SharedParamsRegistry();
-	auto &shared_reg = *shared_reg_ptr;
+void ConnectionLease::Admit() {
+	if (conn == nullptr || admitted) {
+		return;
+	}
+	if (!conn->scheduler->Enter(ConnectionScheduler::WAIT_TIMEOUT_SECONDS)) {
+		throw ScannerException("ODBC connection is used by other queries, timed out waiting for it, id: " +
+		                       std::to_string(conn_id) + ", timeout seconds: " +
+		                       std::to_string(ConnectionScheduler::WAIT_TIMEOUT_SECONDS) +
+		                       ", max active statements: " + std::to_string(conn->scheduler->MaxActive()));
+	}
+	admitted = true;
+}
 
-	int64_t params_id = reinterpret_cast<int64_t>(params.get());
-	auto res = shared_reg.insert(params_id);
-	bool inserted = res.second;
+bool ConnectionLease::TryAdmit() {
+	if (conn == nullptr) {
+		return false;
+	}
+	if (!admitted) {
+		admitted = conn->scheduler->TryEnter();
+	}
+	return admitted;
+}
 
-	if (!inserted) {
-		throw ScannerException("Parameters are already registered, ID: " + std::to_string(params_id));
+void ConnectionLease::Dismiss() noexcept {
+	if (conn == nullptr || !admitted) {
+		return;
 	}
+	conn->scheduler->Leave();
+	admitted = false;
+}
 
-	params.release();
+void ConnectionLease::Reset() noexcept {
+	if (conn == nullptr) {
+		return;
+	}
+	Dismiss();
+	// connection that was removed while leased is closed here
+	auto removed = SharedConnectionsRegistry().EndLease(conn_id);
+	conn_id = -1;
+	conn = nullptr;
+}
 
-	return params_id;
+int64_t ParamsRegistry::Add(std::unique_ptr<std::vector<ScannerValue>> params) {
+	return SharedParamsRegistry().Add(std::move(params));
 }
 
 std::unique_ptr<std::vector<ScannerValue>> ParamsRegistry::Remove(int64_t params_id) {
-	auto mtx = SharedMutex();
-	std::lock_guard<std::mutex> guard(*mtx);
+	return SharedParamsRegistry().Remove(params_id);
+}
 
-	auto shared_reg_ptr = SharedParamsRegistry();
-	auto &shared_reg = *shared_reg_ptr;
+std::unique_ptr<std::vector<ScannerValue>> ParamsRegistry::Take(int64_t params_id) {
+	return SharedParamsRegistry().Take(params_id);
+}
 
-	auto removed_count = shared_reg.erase(params_id);
-	if (removed_count == 0) {
-		return std::unique_ptr<std::vector<ScannerValue>>(nullptr);
+void ParamsRegistry::Return(int64_t params_id, std::unique_ptr<std::vector<ScannerValue>> params) noexcept {
+	if (params.get() == nullptr) {
+		return;
 	}
-
-	std::vector<ScannerValue> *params_ptr = reinterpret_cast<std::vector<ScannerValue> *>(params_id);
-	return std::unique_ptr<std::vector<ScannerValue>>(params_ptr);
+	SharedParamsRegistry().Return(params_id, params);
 }
 
 void Registries::Initialize() {
-	SharedMutex();
 	SharedConnectionsRegistry();
 	SharedParamsRegistry();
 }
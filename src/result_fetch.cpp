@@ -0,0 +1,243 @@
+#include "result_fetch.hpp"
+
+#include <cstdint>
+#include <string>
+
+#include "column_bind.hpp"
+#include "defer.hpp"
+#include "diagnostics.hpp"
+#include "odbc_api.hpp"
+#include "scanner_exception.hpp"
+#include "types.hpp"
+
+DUCKDB_EXTENSION_EXTERN
+
+namespace odbcscanner {
+
+static void BindColumnsInternal(QueryContext &ctx, std::vector<ResultColumn> &columns) {
+	ctx.col_binds.clear();
+	ctx.col_binds.resize(columns.size());
+	for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(columns.size()); col_idxz++) {
+		// set column descriptors and bind columns
+		ResultColumn &col = columns.at(col_idxz);
+		SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+		Types::BindColumn(ctx, col.odbc_type, col_idx);
+	}
+}
+
+static void SetStmtAttr(QueryContext &ctx, SQLINTEGER attr, const std::string &attr_name, SQLPOINTER value) {
+	SQLRETURN ret = SQLSetStmtAttr(ctx.hstmt(), attr, value, 0);
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLSetStmtAttr' failed, attribute: " + attr_name + ", query: '" + ctx.query +
+		                       "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+	}
+}
+
+static void SetupBlockFetch(QueryContext &ctx, std::vector<ResultColumn> &columns) {
+	// Block fetch requires all columns to be bound, variable-length columns
+	// without a known (and reasonably small) declared length are read with
+	// SQLGetData that is generally not supported by drivers with multi-row
+	// rowsets, so we fall back to single-row fetch for them.
+	bool all_bound = true;
+	for (ColumnBind &bind : ctx.col_binds) {
+		if (!bind.IsBound()) {
+			all_bound = false;
+			break;
+		}
+	}
+
+	if (!all_bound) {
+		SQLRETURN ret = SQLFreeStmt(ctx.hstmt(), SQL_UNBIND);
+		if (!SQL_SUCCEEDED(ret)) {
+			std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLFreeStmt' with SQL_UNBIND failed, query: '" + ctx.query +
+			                       "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+		}
+		ctx.rowset_size = 1;
+		BindColumnsInternal(ctx, columns);
+		return;
+	}
+
+	ctx.row_statuses.resize(ctx.rowset_size);
+	SetStmtAttr(ctx, SQL_ATTR_ROW_BIND_TYPE, "SQL_ATTR_ROW_BIND_TYPE",
+	            reinterpret_cast<SQLPOINTER>(SQL_BIND_BY_COLUMN));
+	SetStmtAttr(ctx, SQL_ATTR_ROW_ARRAY_SIZE, "SQL_ATTR_ROW_ARRAY_SIZE",
+	            reinterpret_cast<SQLPOINTER>(static_cast<uintptr_t>(ctx.rowset_size)));
+	SetStmtAttr(ctx, SQL_ATTR_ROW_STATUS_PTR, "SQL_ATTR_ROW_STATUS_PTR",
+	            reinterpret_cast<SQLPOINTER>(ctx.row_statuses.data()));
+	SetStmtAttr(ctx, SQL_ATTR_ROWS_FETCHED_PTR, "SQL_ATTR_ROWS_FETCHED_PTR",
+	            reinterpret_cast<SQLPOINTER>(&ctx.rows_fetched));
+}
+
+// Returns false when there are no more rows
+static bool Fetch(QueryContext &ctx, bool &exhausted) {
+	SQLRETURN ret = SQLFetch(ctx.hstmt());
+	if (SQL_SUCCEEDED(ret)) {
+		return true;
+	}
+	if (ret != SQL_NO_DATA) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLFetch' failed, query: '" + ctx.query + "', return: " + std::to_string(ret) +
+		                       ", diagnostics: '" + diag + "'");
+	}
+	SQLRETURN ret_close = SQLFreeStmt(ctx.hstmt(), SQL_CLOSE);
+	if (!SQL_SUCCEEDED(ret_close)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLFreeStmt' with SQL_CLOSE failed, query: '" + ctx.query +
+		                       "', return: " + std::to_string(ret_close) + ", diagnostics: '" + diag + "'");
+	}
+	exhausted = true;
+	return false;
+}
+
+static void BindColumnToVector(QueryContext &ctx, ResultColumn &col, SQLSMALLINT col_idx, duckdb_vector vec) {
+	ColumnBind &bind = ctx.BindForColumn(col_idx);
+	void *vec_data = duckdb_vector_get_data(vec);
+	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, bind.ctype, vec_data, bind.value_size, &bind.Indicator());
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLBindCol' to vector failed, C type: " + std::to_string(bind.ctype) +
+		                       ", column index: " + std::to_string(col_idx) + ", column type: " +
+		                       col.odbc_type.ToString() + ",  query: '" + ctx.query + "', return: " +
+		                       std::to_string(ret) + ", diagnostics: '" + diag + "'");
+	}
+}
+
+static void SetNullsFromIndicators(QueryContext &ctx, SQLSMALLINT col_idx, duckdb_vector vec, idx_t rows_count) {
+	ColumnBind &bind = ctx.BindForColumn(col_idx);
+	Types::SetNullsFromIndicators(vec, &bind.Indicator(), rows_count);
+}
+
+static idx_t FetchRowset(QueryContext &ctx, bool &exhausted) {
+	ctx.rows_fetched = 0;
+	if (!Fetch(ctx, exhausted)) {
+		return 0;
+	}
+
+	if (ctx.rows_fetched > ctx.rowset_size) {
+		throw ScannerException("Invalid number of rows fetched: " + std::to_string(ctx.rows_fetched) +
+		                       ", rowset size: " + std::to_string(ctx.rowset_size) + ", query: '" + ctx.query + "'");
+	}
+
+	for (SQLULEN row_idx = 0; row_idx < ctx.rows_fetched; row_idx++) {
+		SQLUSMALLINT status = ctx.row_statuses.at(row_idx);
+		if (status == SQL_ROW_ERROR) {
+			std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+			throw ScannerException("'SQLFetch' failed for rowset row, row index: " + std::to_string(row_idx) +
+			                       ", query: '" + ctx.query + "', diagnostics: '" + diag + "'");
+		}
+	}
+
+	return static_cast<idx_t>(ctx.rows_fetched);
+}
+
+void ResultFetch::BindColumns(QueryContext &ctx, std::vector<ResultColumn> &columns) {
+	if (ctx.quirks.enable_columns_binding && ctx.quirks.enable_block_fetch) {
+		ctx.rowset_size = static_cast<SQLULEN>(duckdb_vector_size());
+	}
+	BindColumnsInternal(ctx, columns);
+	if (ctx.rowset_size > 1) {
+		SetupBlockFetch(ctx, columns);
+	}
+
+	ctx.fetch_kernels.clear();
+	for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(columns.size()); col_idxz++) {
+		ResultColumn &col = columns.at(col_idxz);
+		SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+		ctx.fetch_kernels.push_back(Types::ResolveFetchKernel(ctx, col.odbc_type, col_idx));
+	}
+}
+
+static idx_t FetchPrefetched(QueryContext &ctx, std::vector<ResultColumn> &columns,
+                             std::vector<duckdb_vector> &col_vectors, bool &exhausted, Prefetcher &prefetcher) {
+	if (!prefetcher.Next(ctx)) {
+		exhausted = true;
+		return 0;
+	}
+	// buffers are given back even if the conversion fails
+	auto deferred = Defer([&ctx, &prefetcher] { prefetcher.Release(ctx); });
+
+	idx_t rows_count = static_cast<idx_t>(ctx.rows_fetched);
+	for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(columns.size()); col_idxz++) {
+		ResultColumn &col = columns.at(col_idxz);
+		duckdb_vector vec = col_vectors.at(col_idxz);
+		SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+		FetchKernel &kernel = ctx.fetch_kernels.at(col_idxz);
+
+		kernel.fetch_rows(ctx, col.odbc_type, col_idx, vec, rows_count);
+	}
+	return rows_count;
+}
+
+void ResultFetch::Abandon(QueryContext &ctx, std::unique_ptr<Prefetcher> &prefetcher) noexcept {
+	if (!ctx.hstmt_ptr) {
+		prefetcher.reset();
+		return;
+	}
+	// interrupts the fetch call that may be running in the prefetcher thread
+	SQLCancel(ctx.hstmt());
+	prefetcher.reset();
+	SQLFreeStmt(ctx.hstmt(), SQL_CLOSE);
+}
+
+idx_t ResultFetch::FetchChunk(QueryContext &ctx, std::vector<ResultColumn> &columns,
+                              std::vector<duckdb_vector> &col_vectors, bool &exhausted, Prefetcher *prefetcher) {
+
+	// scratch memory of the previous chunk is not used anymore
+	ctx.arena.Reset();
+
+	if (prefetcher != nullptr) {
+		return FetchPrefetched(ctx, columns, col_vectors, exhausted, *prefetcher);
+	}
+
+	// block fetch: whole chunk is fetched with a single SQLFetch call
+
+	if (ctx.rowset_size > 1) {
+		for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(columns.size()); col_idxz++) {
+			SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+			if (ctx.BindForColumn(col_idx).IsDirect()) {
+				BindColumnToVector(ctx, columns.at(col_idxz), col_idx, col_vectors.at(col_idxz));
+			}
+		}
+
+		idx_t rows_count = FetchRowset(ctx, exhausted);
+
+		for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(columns.size()); col_idxz++) {
+			ResultColumn &col = columns.at(col_idxz);
+			duckdb_vector vec = col_vectors.at(col_idxz);
+			SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+
+			if (ctx.BindForColumn(col_idx).IsDirect()) {
+				// values are already written to the vector by the driver
+				SetNullsFromIndicators(ctx, col_idx, vec, rows_count);
+				continue;
+			}
+
+			FetchKernel &kernel = ctx.fetch_kernels.at(col_idxz);
+			kernel.fetch_rows(ctx, col.odbc_type, col_idx, vec, rows_count);
+		}
+		return rows_count;
+	}
+
+	// row-by-row fetch, values of every row are read before fetching the next one
+
+	idx_t row_idx = 0;
+	for (; row_idx < duckdb_vector_size(); row_idx++) {
+		if (!Fetch(ctx, exhausted)) {
+			break;
+		}
+
+		for (idx_t col_idxz = 0; col_idxz < static_cast<idx_t>(columns.size()); col_idxz++) {
+			ResultColumn &col = columns.at(col_idxz);
+			duckdb_vector vec = col_vectors.at(col_idxz);
+			SQLSMALLINT col_idx = static_cast<SQLSMALLINT>(col_idxz + 1);
+			FetchKernel &kernel = ctx.fetch_kernels.at(col_idxz);
+
+			kernel.fetch_value(ctx, col.odbc_type, col_idx, vec, row_idx);
+		}
+	}
+	return row_idx;
+}
+
+} // namespace odbcscanner
@@ -0,0 +1,65 @@
+#include "statement_cache.hpp"
+
+namespace odbcscanner {
+
+std::string StatementCache::Key(const std::string &query, const DbmsQuirks &quirks) {
+	return quirks.Key() + "|" + query;
+}
+
+bool StatementCache::Take(const std::string &key, CachedStatement &stmt_out) {
+	std::lock_guard<std::mutex> guard(mutex);
+	auto it = index.find(key);
+	if (it == index.end()) {
+		return false;
+	}
+	auto entry_it = it->second;
+	index.erase(it);
+	stmt_out = std::move(entry_it->second);
+	entries.erase(entry_it);
+	return true;
+}
+
+void StatementCache::Put(const std::string &key, uint64_t stmt_generation, CachedStatement stmt) {
+	if (stmt_generation != Generation()) {
+		// statement is freed
+		return;
+	}
+	HSTMT hstmt = stmt.hstmt_ptr.get();
+	SQLRETURN ret_close = SQLFreeStmt(hstmt, SQL_CLOSE);
+	SQLRETURN ret_unbind = SQLFreeStmt(hstmt, SQL_UNBIND);
+	SQLRETURN ret_reset = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+	if (!SQL_SUCCEEDED(ret_close) || !SQL_SUCCEEDED(ret_unbind) || !SQL_SUCCEEDED(ret_reset)) {
+		// statement is freed
+		return;
+	}
+
+	// evicted statements are freed after the lock is released
+	std::list<std::pair<std::string, CachedStatement>> evicted;
+	std::lock_guard<std::mutex> guard(mutex);
+	if (stmt_generation != generation) {
+		return;
+	}
+	entries.emplace_front(key, std::move(stmt));
+	index.emplace(key, entries.begin());
+
+	while (entries.size() > capacity) {
+		auto last_it = std::prev(entries.end());
+		auto range = index.equal_range(last_it->first);
+		for (auto it = range.first; it != range.second; ++it) {
+			if (it->second == last_it) {
+				index.erase(it);
+				break;
+			}
+		}
+		evicted.splice(evicted.end(), entries, last_it);
+	}
+}
+
+void StatementCache::Invalidate() {
+	std::lock_guard<std::mutex> guard(mutex);
+	index.clear();
+	entries.clear();
+	generation++;
+}
+
+} // namespace odbcscanner
@@ -0,0 +1,112 @@
+#include "statement_pool.hpp"
+
+#include <cstdint>
+
+namespace odbcscanner {
+
+void StmtHandleDeleter::operator()(HSTMT hstmt) const {
+	if (pool) {
+		pool->Recycle(hstmt);
+		return;
+	}
+	SQLFreeStmt(hstmt, SQL_CLOSE);
+	SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+}
+
+// Resets the state of the statement to the state of a newly allocated one, the attributes that are
+// set by the scanner only when supported by the driver are reset ignoring the failures
+static bool ResetStatement(HSTMT hstmt) {
+	SQLRETURN ret_close = SQLFreeStmt(hstmt, SQL_CLOSE);
+	SQLRETURN ret_unbind = SQLFreeStmt(hstmt, SQL_UNBIND);
+	SQLRETURN ret_reset = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+	if (!SQL_SUCCEEDED(ret_close) || !SQL_SUCCEEDED(ret_unbind) || !SQL_SUCCEEDED(ret_reset)) {
+		return false;
+	}
+
+	SQLRETURN ret_array_size =
+	    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(static_cast<uintptr_t>(1)), 0);
+	SQLRETURN ret_statuses = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+	SQLRETURN ret_fetched = SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+	if (!SQL_SUCCEEDED(ret_array_size) || !SQL_SUCCEEDED(ret_statuses) || !SQL_SUCCEEDED(ret_fetched)) {
+		return false;
+	}
+
+	SQLSetStmtAttr(hstmt, SQL_ATTR_MAX_ROWS, reinterpret_cast<SQLPOINTER>(SQL_MAX_ROWS_DEFAULT), 0);
+	SQLSetStmtAttr(hstmt, SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast<SQLPOINTER>(0), 0);
+	SQLSetStmtAttr(hstmt, SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_OFF), 0);
+	return true;
+}
+
+SQLRETURN StatementPool::Alloc(StmtHandlePtr &hstmt_out) {
+	HSTMT hstmt = SQL_NULL_HSTMT;
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		if (idle.size() > 0) {
+			hstmt = idle.back();
+			idle.pop_back();
+			in_use_count++;
+		}
+	}
+
+	if (hstmt == SQL_NULL_HSTMT) {
+		SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_STMT, dbc, &hstmt);
+		if (!SQL_SUCCEEDED(ret)) {
+			return ret;
+		}
+		std::lock_guard<std::mutex> guard(mutex);
+		in_use_count++;
+	}
+
+	hstmt_out = StmtHandlePtr(hstmt, StmtHandleDeleter(shared_from_this()));
+	return SQL_SUCCESS;
+}
+
+void StatementPool::Recycle(HSTMT hstmt) noexcept {
+	bool closed_snapshot = false;
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		if (in_use_count > 0) {
+			in_use_count--;
+		}
+		closed_snapshot = closed;
+	}
+
+	if (!closed_snapshot && ResetStatement(hstmt)) {
+		std::lock_guard<std::mutex> guard(mutex);
+		if (!closed && idle.size() < capacity) {
+			try {
+				idle.push_back(hstmt);
+				return;
+			} catch (...) {
+				// statement is freed below
+			}
+		}
+	}
+
+	if (!closed_snapshot) {
+		SQLFreeStmt(hstmt, SQL_CLOSE);
+	}
+	SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+}
+
+uint64_t StatementPool::Close() noexcept {
+	std::vector<HSTMT> to_free;
+	uint64_t leaked = 0;
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		closed = true;
+		to_free.swap(idle);
+		leaked = in_use_count;
+	}
+	for (HSTMT hstmt : to_free) {
+		SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+	}
+	return leaked;
+}
+
+uint64_t StatementPool::InUseCount() {
+	std::lock_guard<std::mutex> guard(mutex);
+	return in_use_count;
+}
+
+} // namespace odbcscanner
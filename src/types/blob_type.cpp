@@ -2,6 +2,7 @@
 
 #include <cstring>
 
+#include "arena.hpp"
 #include "binary.hpp"
 #include "capi_pointers.hpp"
 #include "diagnostics.hpp"
@@ -56,7 +57,7 @@ void TypeSpecific::BindOdbcParam<duckdb_blob>(QueryContext &ctx, ScannerValue &p
 	}
 }
 
-static void FetchTail(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<SQLCHAR> &buf, SQLLEN len_bytes) {
+static void FetchTail(QueryContext &ctx, SQLSMALLINT col_idx, ArenaBuffer<SQLCHAR> &buf, SQLLEN len_bytes) {
 	size_t head_size = buf.size();
 	buf.resize(len_bytes);
 
@@ -84,7 +85,7 @@ static void FetchTail(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<SQLCHA
 	}
 }
 
-static void FetchMultiReads(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<SQLCHAR> &buf) {
+static void FetchMultiReads(QueryContext &ctx, SQLSMALLINT col_idx, ArenaBuffer<SQLCHAR> &buf) {
 	for (size_t i = 1; true; i++) {
 		size_t prev_len = buf.size();
 		buf.resize(prev_len * 2);
@@ -116,7 +117,7 @@ static void FetchMultiReads(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<
 	}
 }
 
-static void FetchSinglePart(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<SQLCHAR> &buf, SQLLEN len_bytes) {
+static void FetchSinglePart(QueryContext &ctx, SQLSMALLINT col_idx, ArenaBuffer<SQLCHAR> &buf, SQLLEN len_bytes) {
 	buf.resize(len_bytes);
 	SQLLEN len_read_bytes = 0;
 
@@ -139,8 +140,8 @@ static void FetchSinglePart(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<
 	}
 }
 
-static std::pair<std::vector<SQLCHAR>, bool> FetchInternal(QueryContext &ctx, SQLSMALLINT col_idx) {
-	std::vector<SQLCHAR> buf;
+static std::pair<ArenaBuffer<SQLCHAR>, bool> FetchInternal(QueryContext &ctx, SQLSMALLINT col_idx) {
+	ArenaBuffer<SQLCHAR> buf(ctx.arena);
 	buf.resize(8192);
 	SQLLEN len_bytes = 0;
 	SQLRETURN ret =
@@ -162,41 +163,51 @@ static std::pair<std::vector<SQLCHAR>, bool> FetchInternal(QueryContext &ctx, SQ
 	if (ret == SQL_SUCCESS || diag_code != trunc_diag_code) {
 
 		if (len_bytes == SQL_NULL_DATA) {
-			return std::make_pair(std::vector<SQLCHAR>(), true);
+			return std::make_pair(buf, true);
 		}
 
 		buf.resize(len_bytes);
-		return std::make_pair(std::move(buf), false);
+		return std::make_pair(buf, false);
 	}
 
 	// invariant: ret = SQL_SUCCESS_WITH_INFO && diag_code == "01004"
 
 	if (ctx.quirks.var_len_data_single_part) {
 		FetchSinglePart(ctx, col_idx, buf, len_bytes);
-		return std::make_pair(std::move(buf), false);
+		return std::make_pair(buf, false);
 	}
 
 	if (len_bytes != SQL_NO_TOTAL) {
 		FetchTail(ctx, col_idx, buf, len_bytes);
-		return std::make_pair(std::move(buf), false);
+		return std::make_pair(buf, false);
 	}
 
 	FetchMultiReads(ctx, col_idx, buf);
-	return std::make_pair(std::move(buf), false);
+	return std::make_pair(buf, false);
 }
 
 template <>
 void TypeSpecific::FetchAndSetResult<duckdb_blob>(QueryContext &ctx, OdbcType &, SQLSMALLINT col_idx, duckdb_vector vec,
                                                   idx_t row_idx) {
+	// scratch buffers are only needed until the value is copied into the vector
+	Arena::Mark mark = ctx.arena.GetMark();
+
 	auto fetched = FetchInternal(ctx, col_idx);
 
 	if (fetched.second) {
 		Types::SetNullValueToResult(vec, row_idx);
-		return;
+	} else {
+		Types::SetStringValueToResult(vec, row_idx, reinterpret_cast<char *>(fetched.first.data()),
+		                              fetched.first.size());
 	}
 
-	duckdb_vector_assign_string_element_len(vec, row_idx, reinterpret_cast<char *>(fetched.first.data()),
-	                                        fetched.first.size());
+	ctx.arena.Rewind(mark);
+}
+
+template <>
+void TypeSpecific::SetBoundRows<duckdb_blob>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                             ColumnBind &bind, duckdb_vector vec, idx_t rows_count) {
+	SetBoundRowsPerCell<duckdb_blob>(ctx, odbc_type, col_idx, bind, vec, rows_count);
 }
 
 template <>
@@ -44,11 +44,8 @@ void TypeSpecific::BindColumn<bool>(QueryContext &ctx, OdbcType &odbc_type, SQLS
 		return;
 	}
 	SqlBit sb;
-	ScannerValue nval(sb);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SqlBit>(SQL_C_BIT, ctx.rowset_size);
 	SqlBit &fetched = bind.Value<SqlBit>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_BIT, &fetched.val, sizeof(fetched.val), &ind);
@@ -69,9 +66,10 @@ void TypeSpecific::FetchAndSetResult<bool>(QueryContext &ctx, OdbcType &odbc_typ
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SqlBit &bound = bind.Value<SqlBit>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SqlBit &bound = bind.Value<SqlBit>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_BIT, &fetched_data.val, sizeof(fetched_data.val), &ind);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -93,6 +91,16 @@ void TypeSpecific::FetchAndSetResult<bool>(QueryContext &ctx, OdbcType &odbc_typ
 	data[row_idx] = fetched.val == 1;
 }
 
+template <>
+void TypeSpecific::SetBoundRows<bool>(QueryContext &, OdbcType &, SQLSMALLINT, ColumnBind &bind, duckdb_vector vec,
+                                      idx_t rows_count) {
+	bool *data = reinterpret_cast<bool *>(duckdb_vector_get_data(vec));
+	SqlBit *bound = &bind.Value<SqlBit>();
+	for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+		data[row_idx] = bound[row_idx].val == 1;
+	}
+}
+
 template <>
 duckdb_type TypeSpecific::ResolveColumnType<bool>(QueryContext &, ResultColumn &) {
 	return DUCKDB_TYPE_BOOLEAN;
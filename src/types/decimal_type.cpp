@@ -181,13 +181,47 @@ static void ZeroNumericStruct(SQL_NUMERIC_STRUCT &ns) {
 	}
 }
 
+// Decimal values returned as characters are normalized into a string of digits
+// with exactly 'scale' fractional digits, at most 38 digits are supported
+
+static const size_t MAX_DECIMAL_DIGITS = 38;
+
+// Bound buffer size for decimals fetched as characters: sign, 38 digits,
+// leading zero, separator and nul-terminator
+static const SQLLEN DECIMAL_CHARS_BOUND_SIZE = 64;
+
+// Character representation of decimals has a known max length, so it can be bound
+// without the truncation handling that is needed for VARCHAR columns. Binding is
+// only used with block fetch, single-row fetch reads the values with SQLGetData.
+static void BindColumnChars(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
+	if (ctx.rowset_size <= 1) {
+		return;
+	}
+
+	ColumnBind &bind = ctx.BindForColumn(col_idx);
+	bind = ColumnBind::CreateSized(SQL_C_CHAR, DECIMAL_CHARS_BOUND_SIZE, ctx.rowset_size);
+	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_CHAR, bind.SizedValue<char>(), bind.value_size,
+	                           &bind.Indicator());
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLBindCol' failed, C type: " + std::to_string(SQL_C_CHAR) + ", column index: " +
+		                       std::to_string(col_idx) + ", column type: " + odbc_type.ToString() + ",  query: '" +
+		                       ctx.query + "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+	}
+}
+
 template <>
 void TypeSpecific::BindColumn<duckdb_decimal>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
 	if (ctx.quirks.decimal_columns_precision_through_ard) {
 		SetDescriptorFields(ctx, odbc_type, col_idx);
 	}
 
-	if (!ctx.quirks.enable_columns_binding || ctx.quirks.decimal_columns_as_chars) {
+	if (!ctx.quirks.enable_columns_binding) {
+		return;
+	}
+
+	if (ctx.quirks.decimal_columns_as_chars) {
+		BindColumnChars(ctx, odbc_type, col_idx);
 		return;
 	}
 
@@ -196,13 +230,8 @@ void TypeSpecific::BindColumn<duckdb_decimal>(QueryContext &ctx, OdbcType &odbc_
 		ctype = SQL_ARD_TYPE;
 	}
 
-	SQL_NUMERIC_STRUCT nstruct;
-	ZeroNumericStruct(nstruct);
-	ScannerValue nval(nstruct);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQL_NUMERIC_STRUCT>(ctype, ctx.rowset_size);
 	SQL_NUMERIC_STRUCT &fetched = bind.Value<SQL_NUMERIC_STRUCT>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, ctype, &fetched, sizeof(SQL_NUMERIC_STRUCT), &ind);
@@ -229,75 +258,278 @@ static duckdb_hugeint Zero() {
 	return zero;
 }
 
-// The implementation can be more robust, but we expect the decimal strings from
-// drivers to be well-formed.
-static duckdb_hugeint ParseHugeInt(const std::string &str) {
-	duckdb_hugeint hi;
-	hi.lower = 0;
-	hi.upper = 0;
+struct DecimalDigits {
+	char digits[MAX_DECIMAL_DIGITS + 8];
+	size_t count = 0;
+	bool negative = false;
+};
+
+// Returns false when the string is not a valid decimal number
+static bool NormalizeDecimalChars(const char *str, size_t len, uint8_t scale, DecimalDigits &dd) {
+	const char *pos = str;
+	const char *end = str + len;
+	while (pos != end && *pos == ' ') {
+		pos++;
+	}
+	while (end != pos && (*(end - 1) == ' ' || *(end - 1) == '\0')) {
+		end--;
+	}
+	if (pos != end && (*pos == '-' || *pos == '+')) {
+		dd.negative = *pos == '-';
+		pos++;
+	}
 
-	for (char ch : str) {
-		if (ch < '0' || ch > '9') {
-			return Zero();
-		}
+	// leading zeros are skipped to not count them against the max digits
+	while (pos != end && *pos == '0') {
+		pos++;
+	}
 
-		uint64_t digit = ch - '0';
+	size_t count = 0;
+	for (; pos != end && *pos != '.' && *pos != ','; pos++) {
+		if (*pos < '0' || *pos > '9' || count == MAX_DECIMAL_DIGITS) {
+			return false;
+		}
+		dd.digits[count++] = *pos;
+	}
 
-		hi.upper *= 10;
+	size_t frac_count = 0;
+	if (pos != end) {
+		pos++;
+		for (; pos != end; pos++) {
+			if (*pos < '0' || *pos > '9') {
+				return false;
+			}
+			// fractional digits exceeding the column scale are truncated
+			if (frac_count < scale) {
+				if (count == MAX_DECIMAL_DIGITS) {
+					return false;
+				}
+				dd.digits[count++] = *pos;
+				frac_count++;
+			}
+		}
+	}
 
-		// check overflow
-		if (hi.lower > (std::numeric_limits<uint64_t>::max() / 10)) {
-			uint64_t carry = hi.lower / (std::numeric_limits<uint64_t>::max() / 10);
-			hi.upper += carry;
+	for (; frac_count < scale; frac_count++) {
+		if (count == MAX_DECIMAL_DIGITS) {
+			return false;
 		}
+		dd.digits[count++] = '0';
+	}
 
-		hi.lower *= 10;
-		hi.lower += digit;
+	dd.count = count;
+	return true;
+}
+
+static bool IsLittleEndian() {
+	uint16_t num = 1;
+	uint8_t first = 0;
+	std::memcpy(&first, &num, 1);
+	return first == 1;
+}
+
+// Parses 8 ASCII digits at once, based on the well-known SWAR technique:
+// neighbour digits are combined into 2-digit, 4-digit and then into
+// the final 8-digit number with 3 multiplications
+static uint64_t ParseEightDigits(const char *chars) {
+	uint64_t val = 0;
+	std::memcpy(&val, chars, sizeof(val));
+	val -= 0x3030303030303030ULL;
+	val = (val * 10) + (val >> 8);
+	val = (((val & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+	       (((val >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+	      32;
+	return val;
+}
+
+// Parses up to 19 digits
+static uint64_t ParseDigitsU64(const char *chars, size_t count) {
+	static const bool little_endian = IsLittleEndian();
+	uint64_t res = 0;
+	size_t i = 0;
+	if (little_endian) {
+		for (; i + 8 <= count; i += 8) {
+			res = res * 100000000ULL + ParseEightDigits(chars + i);
+		}
+	}
+	for (; i < count; i++) {
+		res = res * 10 + static_cast<uint64_t>(chars[i] - '0');
 	}
+	return res;
+}
+
+// Multiplies two 64-bit numbers into a 128-bit result
+static void MultiplyU64(uint64_t left, uint64_t right, uint64_t &res_upper, uint64_t &res_lower) {
+	uint64_t left_lo = left & 0xffffffffULL;
+	uint64_t left_hi = left >> 32;
+	uint64_t right_lo = right & 0xffffffffULL;
+	uint64_t right_hi = right >> 32;
+
+	uint64_t lo_lo = left_lo * right_lo;
+	uint64_t lo_hi = left_lo * right_hi;
+	uint64_t hi_lo = left_hi * right_lo;
+	uint64_t hi_hi = left_hi * right_hi;
+
+	uint64_t mid = (lo_lo >> 32) + (lo_hi & 0xffffffffULL) + (hi_lo & 0xffffffffULL);
+	res_lower = (lo_lo & 0xffffffffULL) | (mid << 32);
+	res_upper = hi_hi + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32);
+}
 
+static duckdb_hugeint ParseDigitsHugeInt(const char *chars, size_t count) {
+	static const uint64_t pow10[] = {1ULL,
+	                                 10ULL,
+	                                 100ULL,
+	                                 1000ULL,
+	                                 10000ULL,
+	                                 100000ULL,
+	                                 1000000ULL,
+	                                 10000000ULL,
+	                                 100000000ULL,
+	                                 1000000000ULL,
+	                                 10000000000ULL,
+	                                 100000000000ULL,
+	                                 1000000000000ULL,
+	                                 10000000000000ULL,
+	                                 100000000000000ULL,
+	                                 1000000000000000ULL,
+	                                 10000000000000000ULL,
+	                                 100000000000000000ULL,
+	                                 1000000000000000000ULL};
+
+	duckdb_hugeint hi = Zero();
+	uint64_t lower = 0;
+	uint64_t upper = 0;
+	size_t pos = 0;
+	while (pos < count) {
+		size_t chunk = count - pos < 18 ? count - pos : 18;
+		uint64_t chunk_val = ParseDigitsU64(chars + pos, chunk);
+		pos += chunk;
+
+		// (upper, lower) = (upper, lower) * 10^chunk + chunk_val
+		uint64_t mul_upper = 0;
+		uint64_t mul_lower = 0;
+		MultiplyU64(lower, pow10[chunk], mul_upper, mul_lower);
+		upper = upper * pow10[chunk] + mul_upper;
+		lower = mul_lower + chunk_val;
+		if (lower < mul_lower) {
+			upper += 1;
+		}
+	}
+	hi.lower = lower;
+	hi.upper = static_cast<int64_t>(upper);
 	return hi;
 }
 
-static void SetResult(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec, idx_t row_idx,
-                      duckdb_hugeint hi) {
+// Decoding of the fetched decimal values into the physical type of the
+// DuckDB DECIMAL, that is chosen from the column precision
+template <typename PHYSICAL_TYPE>
+struct DecimalDecoder {
+	static PHYSICAL_TYPE FromNumeric(SQL_NUMERIC_STRUCT &ns) {
+		uint64_t lower = 0;
+		std::memcpy(&lower, ns.val, sizeof(lower));
+		int64_t val = static_cast<int64_t>(lower);
+		return static_cast<PHYSICAL_TYPE>(ns.sign == 0 ? -val : val);
+	}
+
+	static PHYSICAL_TYPE FromChars(const char *str, size_t len, uint8_t scale) {
+		DecimalDigits dd;
+		if (!NormalizeDecimalChars(str, len, scale, dd)) {
+			return 0;
+		}
+		int64_t val = static_cast<int64_t>(ParseDigitsU64(dd.digits, dd.count));
+		return static_cast<PHYSICAL_TYPE>(dd.negative ? -val : val);
+	}
+};
+
+template <>
+struct DecimalDecoder<duckdb_hugeint> {
+	static duckdb_hugeint FromNumeric(SQL_NUMERIC_STRUCT &ns) {
+		duckdb_hugeint hi;
+		std::memcpy(&hi.lower, ns.val, sizeof(hi.lower));
+		std::memcpy(&hi.upper, ns.val + sizeof(hi.lower), sizeof(hi.upper));
+		if (ns.sign == 0) {
+			Negate(hi);
+		}
+		return hi;
+	}
+
+	static duckdb_hugeint FromChars(const char *str, size_t len, uint8_t scale) {
+		DecimalDigits dd;
+		if (!NormalizeDecimalChars(str, len, scale, dd)) {
+			return Zero();
+		}
+		duckdb_hugeint hi = ParseDigitsHugeInt(dd.digits, dd.count);
+		if (dd.negative) {
+			Negate(hi);
+		}
+		return hi;
+	}
+};
+
+static duckdb_type DecimalPhysicalType(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
 	if (odbc_type.decimal_precision <= 4) {
-		int16_t *data = reinterpret_cast<int16_t *>(duckdb_vector_get_data(vec));
-		data[row_idx] = static_cast<int16_t>(hi.lower);
+		return DUCKDB_TYPE_SMALLINT;
 	} else if (odbc_type.decimal_precision <= 9) {
-		int32_t *data = reinterpret_cast<int32_t *>(duckdb_vector_get_data(vec));
-		data[row_idx] = static_cast<int32_t>(hi.lower);
+		return DUCKDB_TYPE_INTEGER;
 	} else if (odbc_type.decimal_precision <= 18) {
-		int64_t *data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(vec));
-		data[row_idx] = static_cast<int64_t>(hi.lower);
+		return DUCKDB_TYPE_BIGINT;
 	} else if (odbc_type.decimal_precision <= 38) {
-		duckdb_hugeint *data = reinterpret_cast<duckdb_hugeint *>(duckdb_vector_get_data(vec));
-		data[row_idx] = hi;
-	} else
+		return DUCKDB_TYPE_HUGEINT;
+	} else {
 		throw ScannerException("Invalid unsupported DECIMAL precision: " + std::to_string(odbc_type.decimal_precision) +
 		                       ", column index: " + std::to_string(col_idx) + ", column type: " + odbc_type.ToString() +
 		                       ",  query: '" + ctx.query);
+	}
 }
 
-static size_t RemoveSeparatorReturnScale(std::string &str) {
-	const char *dot_ptr = std::strchr(str.c_str(), '.');
-	if (dot_ptr != nullptr) {
-		size_t idx = static_cast<size_t>(dot_ptr - str.c_str());
-		str.erase(std::remove(str.begin(), str.end(), '.'), str.end());
-		str.erase(std::remove(str.begin(), str.end(), ','), str.end());
-		return str.length() - idx;
-	} else {
-		const char *comma_ptr = std::strchr(str.c_str(), ',');
-		if (comma_ptr != nullptr) {
-			size_t idx = static_cast<size_t>(comma_ptr - str.c_str());
-			str.erase(std::remove(str.begin(), str.end(), ','), str.end());
-			return str.length() - idx;
-		} else {
-			return 0;
-		}
+template <typename PHYSICAL_TYPE>
+static void SetNumericToResult(SQL_NUMERIC_STRUCT &ns, duckdb_vector vec, idx_t row_idx) {
+	PHYSICAL_TYPE *data = reinterpret_cast<PHYSICAL_TYPE *>(duckdb_vector_get_data(vec));
+	data[row_idx] = DecimalDecoder<PHYSICAL_TYPE>::FromNumeric(ns);
+}
+
+template <typename PHYSICAL_TYPE>
+static void SetCharsToResult(OdbcType &odbc_type, const char *str, size_t len, duckdb_vector vec, idx_t row_idx) {
+	PHYSICAL_TYPE *data = reinterpret_cast<PHYSICAL_TYPE *>(duckdb_vector_get_data(vec));
+	data[row_idx] = DecimalDecoder<PHYSICAL_TYPE>::FromChars(str, len, odbc_type.decimal_scale);
+}
+
+static void SetNumericToResult(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, SQL_NUMERIC_STRUCT &ns,
+                               duckdb_vector vec, idx_t row_idx) {
+	switch (DecimalPhysicalType(ctx, odbc_type, col_idx)) {
+	case DUCKDB_TYPE_SMALLINT:
+		SetNumericToResult<int16_t>(ns, vec, row_idx);
+		break;
+	case DUCKDB_TYPE_INTEGER:
+		SetNumericToResult<int32_t>(ns, vec, row_idx);
+		break;
+	case DUCKDB_TYPE_BIGINT:
+		SetNumericToResult<int64_t>(ns, vec, row_idx);
+		break;
+	default:
+		SetNumericToResult<duckdb_hugeint>(ns, vec, row_idx);
 	}
 }
 
-static std::pair<duckdb_hugeint, bool> FetchDecimal(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
+static void SetCharsToResult(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, const char *str,
+                             size_t len, duckdb_vector vec, idx_t row_idx) {
+	switch (DecimalPhysicalType(ctx, odbc_type, col_idx)) {
+	case DUCKDB_TYPE_SMALLINT:
+		SetCharsToResult<int16_t>(odbc_type, str, len, vec, row_idx);
+		break;
+	case DUCKDB_TYPE_INTEGER:
+		SetCharsToResult<int32_t>(odbc_type, str, len, vec, row_idx);
+		break;
+	case DUCKDB_TYPE_BIGINT:
+		SetCharsToResult<int64_t>(odbc_type, str, len, vec, row_idx);
+		break;
+	default:
+		SetCharsToResult<duckdb_hugeint>(odbc_type, str, len, vec, row_idx);
+	}
+}
+
+static void FetchDecimal(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
+                         idx_t row_idx) {
 	SQL_NUMERIC_STRUCT fetched_data;
 	ZeroNumericStruct(fetched_data);
 	SQL_NUMERIC_STRUCT *fetched_ptr = &fetched_data;
@@ -305,9 +537,10 @@ static std::pair<duckdb_hugeint, bool> FetchDecimal(QueryContext &ctx, OdbcType
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQL_NUMERIC_STRUCT &bound = bind.Value<SQL_NUMERIC_STRUCT>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQL_NUMERIC_STRUCT &bound = bind.Value<SQL_NUMERIC_STRUCT>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLSMALLINT ctype = SQL_C_NUMERIC;
 		if (ctx.quirks.decimal_columns_as_ard_type) {
@@ -324,29 +557,19 @@ static std::pair<duckdb_hugeint, bool> FetchDecimal(QueryContext &ctx, OdbcType
 		fetched_ptr = &fetched_data;
 	}
 
-	SQL_NUMERIC_STRUCT &fetched = *fetched_ptr;
-
 	if (ind == SQL_NULL_DATA) {
-		return std::make_pair(Zero(), true);
-	}
-
-	duckdb_hugeint hi;
-	std::memcpy(&hi.lower, fetched.val, sizeof(hi.lower));
-	std::memcpy(&hi.upper, fetched.val + sizeof(hi.lower), sizeof(hi.upper));
-
-	if (fetched.sign == 0) {
-		Negate(hi);
+		Types::SetNullValueToResult(vec, row_idx);
+		return;
 	}
 
-	return std::make_pair(hi, false);
+	SetNumericToResult(ctx, odbc_type, col_idx, *fetched_ptr, vec, row_idx);
 }
 
-static std::pair<duckdb_hugeint, bool> FetchVarchar(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
-	std::vector<char> buf;
-	buf.resize(128);
+static void FetchVarchar(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
+                         idx_t row_idx) {
+	char buf[DECIMAL_CHARS_BOUND_SIZE * 2];
 	SQLLEN len_bytes = 0;
-	SQLRETURN ret =
-	    SQLGetData(ctx.hstmt(), col_idx, SQL_C_CHAR, buf.data(), static_cast<SQLLEN>(buf.size()), &len_bytes);
+	SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_CHAR, buf, static_cast<SQLLEN>(sizeof(buf)), &len_bytes);
 
 	if (!SQL_SUCCEEDED(ret)) {
 		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
@@ -356,45 +579,96 @@ static std::pair<duckdb_hugeint, bool> FetchVarchar(QueryContext &ctx, OdbcType
 	}
 
 	if (len_bytes == SQL_NULL_DATA) {
-		return std::make_pair(Zero(), true);
+		Types::SetNullValueToResult(vec, row_idx);
+		return;
 	}
 
-	std::string str(buf.data(), len_bytes);
+	size_t len = len_bytes >= 0 && static_cast<size_t>(len_bytes) < sizeof(buf) ? static_cast<size_t>(len_bytes)
+	                                                                             : sizeof(buf) - 1;
+	SetCharsToResult(ctx, odbc_type, col_idx, buf, len, vec, row_idx);
+}
 
-	bool negative = false;
-	if ('-' == str[0]) {
-		str.erase(str.begin());
-		negative = true;
+template <>
+void TypeSpecific::FetchAndSetResult<duckdb_decimal>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                     duckdb_vector vec, idx_t row_idx) {
+	if (ctx.quirks.decimal_columns_as_chars) {
+		FetchVarchar(ctx, odbc_type, col_idx, vec, row_idx);
+	} else {
+		FetchDecimal(ctx, odbc_type, col_idx, vec, row_idx);
 	}
+}
 
-	size_t scale = RemoveSeparatorReturnScale(str);
-	(void)scale;
+// Batch decoding of the bound rowset, physical type and the fetched
+// representation are resolved once for the whole rowset
 
-	if (str.empty()) {
-		return std::make_pair(Zero(), false);
+template <typename PHYSICAL_TYPE>
+static void DecodeNumericRows(ColumnBind &bind, duckdb_vector vec, idx_t rows_count) {
+	PHYSICAL_TYPE *data = reinterpret_cast<PHYSICAL_TYPE *>(duckdb_vector_get_data(vec));
+	Types::SetNullsFromIndicators(vec, &bind.Indicator(), rows_count);
+	for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+		if (bind.Indicator(row_idx) == SQL_NULL_DATA) {
+			continue;
+		}
+		data[row_idx] = DecimalDecoder<PHYSICAL_TYPE>::FromNumeric(bind.Value<SQL_NUMERIC_STRUCT>(row_idx));
 	}
+}
 
-	duckdb_hugeint parsed = ParseHugeInt(str);
-	if (negative) {
-		Negate(parsed);
+template <typename PHYSICAL_TYPE>
+static void DecodeCharsRows(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, ColumnBind &bind,
+                            duckdb_vector vec, idx_t rows_count) {
+	PHYSICAL_TYPE *data = reinterpret_cast<PHYSICAL_TYPE *>(duckdb_vector_get_data(vec));
+	SQLLEN capacity_bytes = bind.value_size - 1;
+	Types::SetNullsFromIndicators(vec, &bind.Indicator(), rows_count);
+	for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+		SQLLEN ind = bind.Indicator(row_idx);
+		if (ind == SQL_NULL_DATA) {
+			continue;
+		}
+		if (ind < 0 || ind > capacity_bytes) {
+			throw ScannerException("DECIMAL value fetched as VARCHAR is too long, length: " + std::to_string(ind) +
+			                       ", max length: " + std::to_string(capacity_bytes) + ", column index: " +
+			                       std::to_string(col_idx) + ", column type: " + odbc_type.ToString() +
+			                       ",  query: '" + ctx.query + "'");
+		}
+		const char *str = bind.SizedValue<char>(row_idx);
+		size_t len = static_cast<size_t>(ind);
+		data[row_idx] = DecimalDecoder<PHYSICAL_TYPE>::FromChars(str, len, odbc_type.decimal_scale);
 	}
-
-	return std::make_pair(parsed, false);
 }
 
-template <>
-void TypeSpecific::FetchAndSetResult<duckdb_decimal>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
-                                                     duckdb_vector vec, idx_t row_idx) {
-	std::pair<duckdb_hugeint, bool> fetched;
+template <typename PHYSICAL_TYPE>
+static void DecodeRows(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
+                       idx_t rows_count) {
+	ColumnBind &bind = ctx.BindForColumn(col_idx);
 	if (ctx.quirks.decimal_columns_as_chars) {
-		fetched = FetchVarchar(ctx, odbc_type, col_idx);
+		DecodeCharsRows<PHYSICAL_TYPE>(ctx, odbc_type, col_idx, bind, vec, rows_count);
 	} else {
-		fetched = FetchDecimal(ctx, odbc_type, col_idx);
+		DecodeNumericRows<PHYSICAL_TYPE>(bind, vec, rows_count);
 	}
-	if (fetched.second) {
-		Types::SetNullValueToResult(vec, row_idx);
-	} else {
-		SetResult(ctx, odbc_type, col_idx, vec, row_idx, fetched.first);
+}
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_decimal>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                   duckdb_vector vec, idx_t rows_count) {
+	if (!ctx.quirks.enable_columns_binding || !ctx.BindForColumn(col_idx).IsBound()) {
+		for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+			FetchAndSetResult<duckdb_decimal>(ctx, odbc_type, col_idx, vec, row_idx);
+		}
+		return;
+	}
+
+	switch (DecimalPhysicalType(ctx, odbc_type, col_idx)) {
+	case DUCKDB_TYPE_SMALLINT:
+		DecodeRows<int16_t>(ctx, odbc_type, col_idx, vec, rows_count);
+		break;
+	case DUCKDB_TYPE_INTEGER:
+		DecodeRows<int32_t>(ctx, odbc_type, col_idx, vec, rows_count);
+		break;
+	case DUCKDB_TYPE_BIGINT:
+		DecodeRows<int64_t>(ctx, odbc_type, col_idx, vec, rows_count);
+		break;
+	default:
+		DecodeRows<duckdb_hugeint>(ctx, odbc_type, col_idx, vec, rows_count);
 	}
 }
 
@@ -75,11 +75,13 @@ void BindColumnInternal(QueryContext &ctx, SQLSMALLINT ctype, OdbcType &odbc_typ
 	if (!ctx.quirks.enable_columns_binding) {
 		return;
 	}
-	ScannerValue nval(static_cast<FLOAT_TYPE>(0));
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	if (ctx.rowset_size > 1) {
+		// zero-copy, column is bound to the vector memory before every fetch
+		bind = ColumnBind::CreateDirect<FLOAT_TYPE>(ctype, ctx.rowset_size);
+		return;
+	}
+	bind = ColumnBind::Create<FLOAT_TYPE>(ctype, ctx.rowset_size);
 	FLOAT_TYPE &fetched = bind.Value<FLOAT_TYPE>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, ctype, &fetched, sizeof(fetched), &ind);
@@ -110,9 +112,10 @@ static void FetchAndSetResultInternal(QueryContext &ctx, SQLSMALLINT ctype, Odbc
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		FLOAT_TYPE &bound = bind.Value<FLOAT_TYPE>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		FLOAT_TYPE &bound = bind.Value<FLOAT_TYPE>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, ctype, &fetched_data, sizeof(fetched_data), &ind);
 		if (!SQL_SUCCEEDED(ret)) {
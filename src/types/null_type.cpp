@@ -26,4 +26,26 @@ void Types::SetNullValueToResult(duckdb_vector vec, idx_t row_idx) {
 	duckdb_validity_set_row_invalid(validity, row_idx);
 }
 
+void Types::SetNullsFromIndicators(duckdb_vector vec, const SQLLEN *inds, idx_t rows_count) {
+	// validity mask is only materialized when the rowset contains NULLs
+	uint64_t *validity = nullptr;
+	for (idx_t word_start = 0; word_start < rows_count; word_start += 64) {
+		idx_t word_rows = rows_count - word_start < 64 ? rows_count - word_start : 64;
+		const SQLLEN *word_inds = inds + word_start;
+		// bits past the end of the rowset are left valid
+		uint64_t valid_bits = word_rows == 64 ? 0 : ~static_cast<uint64_t>(0) << word_rows;
+		for (idx_t i = 0; i < word_rows; i++) {
+			valid_bits |= static_cast<uint64_t>(word_inds[i] != SQL_NULL_DATA) << i;
+		}
+		if (valid_bits == ~static_cast<uint64_t>(0)) {
+			continue;
+		}
+		if (validity == nullptr) {
+			duckdb_vector_ensure_validity_writable(vec);
+			validity = duckdb_vector_get_validity(vec);
+		}
+		validity[word_start / 64] &= valid_bits;
+	}
+}
+
 } // namespace odbcscanner
@@ -191,15 +191,8 @@ void TypeSpecific::BindColumn<duckdb_date_struct>(QueryContext &ctx, OdbcType &o
 	if (!ctx.quirks.enable_columns_binding) {
 		return;
 	}
-	SQL_DATE_STRUCT nstruct;
-	nstruct.year = 0;
-	nstruct.month = 0;
-	nstruct.day = 0;
-	ScannerValue nval(nstruct);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQL_DATE_STRUCT>(SQL_C_TYPE_DATE, ctx.rowset_size);
 	SQL_DATE_STRUCT &fetched = bind.Value<SQL_DATE_STRUCT>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_TYPE_DATE, &fetched, sizeof(fetched), &ind);
@@ -212,15 +205,8 @@ void TypeSpecific::BindColumn<duckdb_date_struct>(QueryContext &ctx, OdbcType &o
 }
 
 static void BindColumnTime(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
-	SQL_TIME_STRUCT nstruct;
-	nstruct.hour = 0;
-	nstruct.minute = 0;
-	nstruct.second = 0;
-	ScannerValue nval(nstruct);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQL_TIME_STRUCT>(SQL_C_TYPE_TIME, ctx.rowset_size);
 	SQL_TIME_STRUCT &fetched = bind.Value<SQL_TIME_STRUCT>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_TYPE_TIME, &fetched, sizeof(fetched), &ind);
@@ -233,16 +219,8 @@ static void BindColumnTime(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT c
 }
 
 static void BindColumnSSTime2(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
-	SQL_SS_TIME2_STRUCT nstruct;
-	nstruct.hour = 0;
-	nstruct.minute = 0;
-	nstruct.second = 0;
-	nstruct.fraction = 0;
-	ScannerValue nval(nstruct);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQL_SS_TIME2_STRUCT>(SQL_C_BINARY, ctx.rowset_size);
 	SQL_SS_TIME2_STRUCT &fetched = bind.Value<SQL_SS_TIME2_STRUCT>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_BINARY, &fetched, sizeof(fetched), &ind);
@@ -274,19 +252,8 @@ void TypeSpecific::BindColumn<duckdb_time_struct>(QueryContext &ctx, OdbcType &o
 }
 
 static void BindColumnTimestamp(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
-	SQL_TIMESTAMP_STRUCT nstruct;
-	nstruct.year = 0;
-	nstruct.month = 0;
-	nstruct.day = 0;
-	nstruct.hour = 0;
-	nstruct.minute = 0;
-	nstruct.second = 0;
-	nstruct.fraction = 0;
-	ScannerValue nval(nstruct);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQL_TIMESTAMP_STRUCT>(SQL_C_TYPE_TIMESTAMP, ctx.rowset_size);
 	SQL_TIMESTAMP_STRUCT &fetched = bind.Value<SQL_TIMESTAMP_STRUCT>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_TYPE_TIMESTAMP, &fetched, sizeof(fetched), &ind);
@@ -300,21 +267,8 @@ static void BindColumnTimestamp(QueryContext &ctx, OdbcType &odbc_type, SQLSMALL
 }
 
 static void BindColumnSSTimestampOffset(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
-	SQL_SS_TIMESTAMPOFFSET_STRUCT nstruct;
-	nstruct.year = 0;
-	nstruct.month = 0;
-	nstruct.day = 0;
-	nstruct.hour = 0;
-	nstruct.minute = 0;
-	nstruct.second = 0;
-	nstruct.fraction = 0;
-	nstruct.timezone_hour = 0;
-	nstruct.timezone_minute = 0;
-	ScannerValue nval(nstruct);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQL_SS_TIMESTAMPOFFSET_STRUCT>(SQL_C_BINARY, ctx.rowset_size);
 	SQL_SS_TIMESTAMPOFFSET_STRUCT &fetched = bind.Value<SQL_SS_TIMESTAMPOFFSET_STRUCT>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_BINARY, &fetched, sizeof(fetched), &ind);
@@ -338,6 +292,174 @@ void TypeSpecific::BindColumn<duckdb_timestamp_struct>(QueryContext &ctx, OdbcTy
 	}
 }
 
+// Conversion of the ODBC temporal structs into DuckDB values, done in-place
+// without calling into DuckDB for every value
+
+static const int64_t MICROS_PER_SECOND = 1000 * 1000;
+static const int64_t MICROS_PER_DAY = 24 * 60 * 60 * MICROS_PER_SECOND;
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar,
+// based on http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+static int32_t DaysFromCivil(int32_t year, uint32_t month, uint32_t day) {
+	year -= month <= 2 ? 1 : 0;
+	int32_t era = (year >= 0 ? year : year - 399) / 400;
+	uint32_t yoe = static_cast<uint32_t>(year - era * 400);
+	uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+static int64_t TimeOfDayMicros(SQLUSMALLINT hour, SQLUSMALLINT minute, SQLUSMALLINT second) {
+	return ((static_cast<int64_t>(hour) * 60 + static_cast<int64_t>(minute)) * 60 + static_cast<int64_t>(second)) *
+	       MICROS_PER_SECOND;
+}
+
+// Fractional seconds are returned by drivers in nanoseconds, digits beyond
+// 'timestamp_max_fraction_precision' are truncated
+struct FractionScale {
+	SQLUINTEGER nanos_unit = 1;
+
+	explicit FractionScale(DbmsQuirks &quirks) {
+		uint8_t precision = quirks.timestamp_max_fraction_precision;
+		for (uint8_t i = precision; i < 9; i++) {
+			nanos_unit *= 10;
+		}
+	}
+
+	int64_t Nanos(SQLUINTEGER fraction) const {
+		return static_cast<int64_t>(fraction - fraction % nanos_unit);
+	}
+
+	int64_t Micros(SQLUINTEGER fraction) const {
+		return Nanos(fraction) / 1000;
+	}
+};
+
+struct DateConverter {
+	typedef SQL_DATE_STRUCT odbc_type;
+	typedef duckdb_date duckdb_value_type;
+
+	duckdb_date operator()(const SQL_DATE_STRUCT &fetched) const {
+		duckdb_date dt;
+		dt.days = DaysFromCivil(static_cast<int32_t>(fetched.year), fetched.month, fetched.day);
+		return dt;
+	}
+};
+
+struct TimeConverter {
+	typedef SQL_TIME_STRUCT odbc_type;
+	typedef duckdb_time duckdb_value_type;
+
+	duckdb_time operator()(const SQL_TIME_STRUCT &fetched) const {
+		duckdb_time tm;
+		tm.micros = TimeOfDayMicros(fetched.hour, fetched.minute, fetched.second);
+		return tm;
+	}
+};
+
+struct SSTime2Converter {
+	typedef SQL_SS_TIME2_STRUCT odbc_type;
+	typedef duckdb_time duckdb_value_type;
+
+	FractionScale scale;
+
+	explicit SSTime2Converter(DbmsQuirks &quirks) : scale(quirks) {
+	}
+
+	duckdb_time operator()(const SQL_SS_TIME2_STRUCT &fetched) const {
+		duckdb_time tm;
+		tm.micros = TimeOfDayMicros(fetched.hour, fetched.minute, fetched.second) + scale.Micros(fetched.fraction);
+		return tm;
+	}
+};
+
+template <typename STRUCT>
+static int64_t TimestampMicrosNoFraction(const STRUCT &fetched) {
+	int64_t days = DaysFromCivil(static_cast<int32_t>(fetched.year), fetched.month, fetched.day);
+	return days * MICROS_PER_DAY + TimeOfDayMicros(fetched.hour, fetched.minute, fetched.second);
+}
+
+struct TimestampConverter {
+	typedef SQL_TIMESTAMP_STRUCT odbc_type;
+	typedef duckdb_timestamp duckdb_value_type;
+
+	FractionScale scale;
+
+	explicit TimestampConverter(DbmsQuirks &quirks) : scale(quirks) {
+	}
+
+	duckdb_timestamp operator()(const SQL_TIMESTAMP_STRUCT &fetched) const {
+		duckdb_timestamp ts;
+		ts.micros = TimestampMicrosNoFraction(fetched) + scale.Micros(fetched.fraction);
+		return ts;
+	}
+};
+
+struct TimestampNsConverter {
+	typedef SQL_TIMESTAMP_STRUCT odbc_type;
+	typedef duckdb_timestamp_ns duckdb_value_type;
+
+	FractionScale scale;
+
+	explicit TimestampNsConverter(DbmsQuirks &quirks) : scale(quirks) {
+	}
+
+	duckdb_timestamp_ns operator()(const SQL_TIMESTAMP_STRUCT &fetched) const {
+		// values outside of the TIMESTAMP_NS range are clamped to it
+		static const int64_t max_micros = std::numeric_limits<int64_t>::max() / 1000 - 1;
+		int64_t micros = TimestampMicrosNoFraction(fetched);
+		duckdb_timestamp_ns tns;
+		if (micros > max_micros) {
+			tns.nanos = std::numeric_limits<int64_t>::max();
+		} else if (micros < -max_micros) {
+			tns.nanos = -std::numeric_limits<int64_t>::max();
+		} else {
+			tns.nanos = micros * 1000 + scale.Nanos(fetched.fraction);
+		}
+		return tns;
+	}
+};
+
+struct SSTimestampOffsetConverter {
+	typedef SQL_SS_TIMESTAMPOFFSET_STRUCT odbc_type;
+	typedef duckdb_timestamp duckdb_value_type;
+
+	FractionScale scale;
+
+	explicit SSTimestampOffsetConverter(DbmsQuirks &quirks) : scale(quirks) {
+	}
+
+	duckdb_timestamp operator()(const SQL_SS_TIMESTAMPOFFSET_STRUCT &fetched) const {
+		// normalized to UTC
+		int64_t offset_seconds =
+		    static_cast<int64_t>(fetched.timezone_hour) * 3600 + static_cast<int64_t>(fetched.timezone_minute) * 60;
+		duckdb_timestamp ts;
+		ts.micros = TimestampMicrosNoFraction(fetched) + scale.Micros(fetched.fraction) -
+		            offset_seconds * MICROS_PER_SECOND;
+		return ts;
+	}
+};
+
+// Converts all the values of the bound rowset in a single pass
+template <typename CONVERTER>
+static void ConvertBoundRows(QueryContext &ctx, SQLSMALLINT col_idx, duckdb_vector vec, idx_t rows_count,
+                             const CONVERTER &converter) {
+	typedef typename CONVERTER::odbc_type odbc_struct_type;
+	typedef typename CONVERTER::duckdb_value_type duckdb_value_type;
+
+	ColumnBind &bind = ctx.BindForColumn(col_idx);
+	odbc_struct_type *fetched = &bind.Value<odbc_struct_type>();
+	SQLLEN *inds = &bind.Indicator();
+	duckdb_value_type *data = reinterpret_cast<duckdb_value_type *>(duckdb_vector_get_data(vec));
+	Types::SetNullsFromIndicators(vec, inds, rows_count);
+	for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+		if (inds[row_idx] == SQL_NULL_DATA) {
+			continue;
+		}
+		data[row_idx] = converter(fetched[row_idx]);
+	}
+}
+
 template <>
 void TypeSpecific::FetchAndSetResult<duckdb_date_struct>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
                                                          duckdb_vector vec, idx_t row_idx) {
@@ -350,9 +472,10 @@ void TypeSpecific::FetchAndSetResult<duckdb_date_struct>(QueryContext &ctx, Odbc
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQL_DATE_STRUCT &bound = bind.Value<SQL_DATE_STRUCT>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQL_DATE_STRUCT &bound = bind.Value<SQL_DATE_STRUCT>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_TYPE_DATE, &fetched_data, sizeof(fetched_data), &ind);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -371,15 +494,8 @@ void TypeSpecific::FetchAndSetResult<duckdb_date_struct>(QueryContext &ctx, Odbc
 		return;
 	}
 
-	duckdb_date_struct dts;
-	dts.year = static_cast<int32_t>(fetched.year);
-	dts.month = static_cast<int8_t>(fetched.month);
-	dts.day = static_cast<int8_t>(fetched.day);
-
-	duckdb_date dt = duckdb_to_date(dts);
-
 	duckdb_date *data = reinterpret_cast<duckdb_date *>(duckdb_vector_get_data(vec));
-	data[row_idx] = dt;
+	data[row_idx] = DateConverter()(fetched);
 }
 
 static void FetchAndSetResultTime(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
@@ -393,9 +509,10 @@ static void FetchAndSetResultTime(QueryContext &ctx, OdbcType &odbc_type, SQLSMA
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQL_TIME_STRUCT &bound = bind.Value<SQL_TIME_STRUCT>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQL_TIME_STRUCT &bound = bind.Value<SQL_TIME_STRUCT>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_TYPE_TIME, &fetched_data, sizeof(fetched_data), &ind);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -414,16 +531,8 @@ static void FetchAndSetResultTime(QueryContext &ctx, OdbcType &odbc_type, SQLSMA
 		return;
 	}
 
-	duckdb_time_struct tms;
-	tms.hour = static_cast<int8_t>(fetched.hour);
-	tms.min = static_cast<int8_t>(fetched.minute);
-	tms.sec = static_cast<int8_t>(fetched.second);
-	tms.micros = 0;
-
-	duckdb_time tm = duckdb_to_time(tms);
-
 	duckdb_time *data = reinterpret_cast<duckdb_time *>(duckdb_vector_get_data(vec));
-	data[row_idx] = tm;
+	data[row_idx] = TimeConverter()(fetched);
 }
 
 static void FetchAndSetResultSSTime2(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
@@ -439,9 +548,10 @@ static void FetchAndSetResultSSTime2(QueryContext &ctx, OdbcType &odbc_type, SQL
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQL_SS_TIME2_STRUCT &bound = bind.Value<SQL_SS_TIME2_STRUCT>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQL_SS_TIME2_STRUCT &bound = bind.Value<SQL_SS_TIME2_STRUCT>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_BINARY, &fetched_data, sizeof(fetched_data), &ind);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -460,16 +570,8 @@ static void FetchAndSetResultSSTime2(QueryContext &ctx, OdbcType &odbc_type, SQL
 		return;
 	}
 
-	duckdb_time_struct tms;
-	tms.hour = static_cast<int8_t>(fetched.hour);
-	tms.min = static_cast<int8_t>(fetched.minute);
-	tms.sec = static_cast<int8_t>(fetched.second);
-	tms.micros = static_cast<int32_t>(fetched.fraction / 1000);
-
-	duckdb_time tm = duckdb_to_time(tms);
-
 	duckdb_time *data = reinterpret_cast<duckdb_time *>(duckdb_vector_get_data(vec));
-	data[row_idx] = tm;
+	data[row_idx] = SSTime2Converter(ctx.quirks)(fetched);
 }
 
 template <>
@@ -488,35 +590,6 @@ void TypeSpecific::FetchAndSetResult<duckdb_time_struct>(QueryContext &ctx, Odbc
 	}
 }
 
-static int64_t MicrosToNanos(duckdb_timestamp ts_no_fraction, SQLUINTEGER fetched_fraction) {
-	uint64_t fraction = static_cast<uint64_t>(fetched_fraction);
-	bool negative = ts_no_fraction.micros < 0;
-	// convert to nanos checking overflow
-	uint64_t umicros = static_cast<uint64_t>(std::llabs(ts_no_fraction.micros));
-	uint64_t unanos = 0;
-	if (umicros > std::numeric_limits<uint64_t>::max() / 1000) {
-		unanos = std::numeric_limits<uint64_t>::max();
-	} else {
-		unanos = umicros * 1000;
-		if (unanos > std::numeric_limits<uint64_t>::max() - fraction) {
-			unanos = std::numeric_limits<uint64_t>::max();
-		} else {
-			unanos += fraction;
-		}
-	}
-	// convert to signed, for negative overflow (min + 1) is returned
-	int64_t nanos = 0;
-	if (unanos > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
-		nanos = std::numeric_limits<int64_t>::max();
-	} else {
-		nanos = static_cast<int64_t>(unanos);
-	}
-	if (negative) {
-		nanos = -nanos;
-	}
-	return nanos;
-}
-
 static void FetchAndSetResultTimestamp(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
                                        idx_t row_idx) {
 	SQL_TIMESTAMP_STRUCT fetched_data;
@@ -532,9 +605,10 @@ static void FetchAndSetResultTimestamp(QueryContext &ctx, OdbcType &odbc_type, S
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQL_TIMESTAMP_STRUCT &bound = bind.Value<SQL_TIMESTAMP_STRUCT>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQL_TIMESTAMP_STRUCT &bound = bind.Value<SQL_TIMESTAMP_STRUCT>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret =
 		    SQLGetData(ctx.hstmt(), col_idx, SQL_C_TYPE_TIMESTAMP, &fetched_data, sizeof(fetched_data), &ind);
@@ -554,26 +628,12 @@ static void FetchAndSetResultTimestamp(QueryContext &ctx, OdbcType &odbc_type, S
 		return;
 	}
 
-	duckdb_timestamp_struct tss;
-	tss.date.year = static_cast<int32_t>(fetched.year);
-	tss.date.month = static_cast<int8_t>(fetched.month);
-	tss.date.day = static_cast<int8_t>(fetched.day);
-	tss.time.hour = static_cast<int8_t>(fetched.hour);
-	tss.time.min = static_cast<int8_t>(fetched.minute);
-	tss.time.sec = static_cast<int8_t>(fetched.second);
-	tss.time.micros = 0;
-
 	if (ctx.quirks.timestamp_columns_as_timestamp_ns) {
-		duckdb_timestamp ts_no_fraction = duckdb_to_timestamp(tss);
-		duckdb_timestamp_ns tns;
-		tns.nanos = MicrosToNanos(ts_no_fraction, fetched.fraction);
 		duckdb_timestamp_ns *data = reinterpret_cast<duckdb_timestamp_ns *>(duckdb_vector_get_data(vec));
-		data[row_idx] = tns;
+		data[row_idx] = TimestampNsConverter(ctx.quirks)(fetched);
 	} else {
-		tss.time.micros = static_cast<int32_t>(fetched.fraction / 1000);
-		duckdb_timestamp ts = duckdb_to_timestamp(tss);
 		duckdb_timestamp *data = reinterpret_cast<duckdb_timestamp *>(duckdb_vector_get_data(vec));
-		data[row_idx] = ts;
+		data[row_idx] = TimestampConverter(ctx.quirks)(fetched);
 	}
 }
 
@@ -594,9 +654,10 @@ static void FetchAndSetResultSSTimestampOffset(QueryContext &ctx, OdbcType &odbc
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQL_SS_TIMESTAMPOFFSET_STRUCT &bound = bind.Value<SQL_SS_TIMESTAMPOFFSET_STRUCT>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQL_SS_TIMESTAMPOFFSET_STRUCT &bound = bind.Value<SQL_SS_TIMESTAMPOFFSET_STRUCT>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_BINARY, &fetched_data, sizeof(fetched_data), &ind);
 		if (!SQL_SUCCEEDED(ret)) {
@@ -614,23 +675,8 @@ static void FetchAndSetResultSSTimestampOffset(QueryContext &ctx, OdbcType &odbc
 		return;
 	}
 
-	duckdb_timestamp_struct tss;
-	tss.date.year = static_cast<int32_t>(fetched.year);
-	tss.date.month = static_cast<int8_t>(fetched.month);
-	tss.date.day = static_cast<int8_t>(fetched.day);
-	tss.time.hour = static_cast<int8_t>(fetched.hour);
-	tss.time.min = static_cast<int8_t>(fetched.minute);
-	tss.time.sec = static_cast<int8_t>(fetched.second);
-	tss.time.micros = static_cast<int32_t>(fetched.fraction / 1000);
-	duckdb_timestamp ts = duckdb_to_timestamp(tss);
-
-	int64_t offset_seconds =
-	    static_cast<int64_t>(fetched.timezone_hour) * 3600 + static_cast<int64_t>(fetched.timezone_minute) * 60;
-	int64_t offset_micros = offset_seconds * 1000 * 1000;
-	ts.micros -= offset_micros;
-
 	duckdb_timestamp *data = reinterpret_cast<duckdb_timestamp *>(duckdb_vector_get_data(vec));
-	data[row_idx] = ts;
+	data[row_idx] = SSTimestampOffsetConverter(ctx.quirks)(fetched);
 }
 
 template <>
@@ -643,6 +689,61 @@ void TypeSpecific::FetchAndSetResult<duckdb_timestamp_struct>(QueryContext &ctx,
 	}
 }
 
+// Block-fetched rowsets are converted with a single pass over the bound structs,
+// columns that are not bound are read value by value
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_date_struct>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                       duckdb_vector vec, idx_t rows_count) {
+	if (!ctx.quirks.enable_columns_binding || !ctx.BindForColumn(col_idx).IsBound()) {
+		for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+			FetchAndSetResult<duckdb_date_struct>(ctx, odbc_type, col_idx, vec, row_idx);
+		}
+		return;
+	}
+	ConvertBoundRows(ctx, col_idx, vec, rows_count, DateConverter());
+}
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_time_struct>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                                       duckdb_vector vec, idx_t rows_count) {
+	if (!ctx.quirks.enable_columns_binding || !ctx.BindForColumn(col_idx).IsBound()) {
+		for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+			FetchAndSetResult<duckdb_time_struct>(ctx, odbc_type, col_idx, vec, row_idx);
+		}
+		return;
+	}
+	switch (odbc_type.desc_concise_type) {
+	case SQL_TYPE_TIME:
+		ConvertBoundRows(ctx, col_idx, vec, rows_count, TimeConverter());
+		break;
+	case Types::SQL_SS_TIME2:
+		ConvertBoundRows(ctx, col_idx, vec, rows_count, SSTime2Converter(ctx.quirks));
+		break;
+	default:
+		throw ScannerException("Unsupported ODBC TIME fetch type: " + odbc_type.ToString() + ", query: '" + ctx.query +
+		                       "', column idx: " + std::to_string(col_idx));
+	}
+}
+
+template <>
+void TypeSpecific::FetchAndSetRows<duckdb_timestamp_struct>(QueryContext &ctx, OdbcType &odbc_type,
+                                                            SQLSMALLINT col_idx, duckdb_vector vec, idx_t rows_count) {
+	if (!ctx.quirks.enable_columns_binding || !ctx.BindForColumn(col_idx).IsBound()) {
+		for (idx_t row_idx = 0; row_idx < rows_count; row_idx++) {
+			FetchAndSetResult<duckdb_timestamp_struct>(ctx, odbc_type, col_idx, vec, row_idx);
+		}
+		return;
+	}
+	if (odbc_type.desc_concise_type == Types::SQL_SS_TIMESTAMPOFFSET) {
+		ConvertBoundRows(ctx, col_idx, vec, rows_count, SSTimestampOffsetConverter(ctx.quirks));
+	} else if (ctx.quirks.timestamp_columns_as_timestamp_ns) {
+		ConvertBoundRows(ctx, col_idx, vec, rows_count, TimestampNsConverter(ctx.quirks));
+	} else {
+		ConvertBoundRows(ctx, col_idx, vec, rows_count, TimestampConverter(ctx.quirks));
+	}
+}
+
 template <>
 duckdb_type TypeSpecific::ResolveColumnType<duckdb_date_struct>(QueryContext &, ResultColumn &) {
 	return DUCKDB_TYPE_DATE;
@@ -16,7 +16,8 @@ namespace odbcscanner {
 std::string OdbcType::ToString() {
 	return "code: " + std::to_string(desc_type) + ", concise type: " + std::to_string(desc_concise_type) +
 	       ", type name: '" + desc_type_name + "', unsigned: " + std::to_string(is_unsigned) +
-	       ", precision: " + std::to_string(decimal_precision) + ", scale: " + std::to_string(decimal_scale);
+	       ", precision: " + std::to_string(decimal_precision) + ", scale: " + std::to_string(decimal_scale) +
+	       ", length: " + std::to_string(desc_length) + ", octet length: " + std::to_string(desc_octet_length);
 }
 
 bool OdbcType::Equals(OdbcType &other) {
@@ -251,6 +252,12 @@ void Types::BindColumn(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_i
 	case SQL_NUMERIC:
 		TypeSpecific::BindColumn<duckdb_decimal>(ctx, odbc_type, col_idx);
 		break;
+	case SQL_CHAR:
+	case SQL_VARCHAR:
+	case SQL_WCHAR:
+	case SQL_WVARCHAR:
+		TypeSpecific::BindColumn<std::string>(ctx, odbc_type, col_idx);
+		break;
 	case SQL_GUID:
 		TypeSpecific::BindColumn<ScannerUuid>(ctx, odbc_type, col_idx);
 		break;
@@ -269,78 +276,63 @@ void Types::BindColumn(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_i
 	}
 }
 
-void Types::FetchAndSetResult(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx, duckdb_vector vec,
-                              idx_t row_idx) {
+FetchKernel Types::ResolveFetchKernel(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
 	switch (odbc_type.desc_concise_type) {
 	case SQL_BIT:
-		TypeSpecific::FetchAndSetResult<bool>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<bool>();
 	case SQL_TINYINT:
 		if (odbc_type.is_unsigned) {
-			TypeSpecific::FetchAndSetResult<uint8_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<uint8_t>();
 		} else {
-			TypeSpecific::FetchAndSetResult<int8_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<int8_t>();
 		}
-		break;
 	case SQL_SMALLINT:
 		if (odbc_type.is_unsigned) {
-			TypeSpecific::FetchAndSetResult<uint16_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<uint16_t>();
 		} else {
-			TypeSpecific::FetchAndSetResult<int16_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<int16_t>();
 		}
-		break;
 	case SQL_INTEGER:
 		if (odbc_type.is_unsigned) {
-			TypeSpecific::FetchAndSetResult<uint32_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<uint32_t>();
 		} else {
-			TypeSpecific::FetchAndSetResult<int32_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<int32_t>();
 		}
-		break;
 	case SQL_BIGINT:
 		if (odbc_type.is_unsigned) {
-			TypeSpecific::FetchAndSetResult<uint64_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<uint64_t>();
 		} else {
-			TypeSpecific::FetchAndSetResult<int64_t>(ctx, odbc_type, col_idx, vec, row_idx);
+			return TypeSpecific::CreateFetchKernel<int64_t>();
 		}
-		break;
 	case SQL_REAL:
-		TypeSpecific::FetchAndSetResult<float>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<float>();
 	case SQL_DOUBLE:
 	case SQL_FLOAT:
-		TypeSpecific::FetchAndSetResult<double>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<double>();
 	case SQL_DECIMAL:
 	case SQL_NUMERIC:
-		TypeSpecific::FetchAndSetResult<duckdb_decimal>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<duckdb_decimal>();
 	case SQL_CHAR:
 	case SQL_VARCHAR:
 	case SQL_LONGVARCHAR:
 	case SQL_WCHAR:
 	case SQL_WVARCHAR:
 	case SQL_WLONGVARCHAR:
-		TypeSpecific::FetchAndSetResult<std::string>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<std::string>();
 	case SQL_BINARY:
 	case SQL_VARBINARY:
 	case SQL_LONGVARBINARY:
-		TypeSpecific::FetchAndSetResult<duckdb_blob>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<duckdb_blob>();
 	case SQL_GUID:
-		TypeSpecific::FetchAndSetResult<ScannerUuid>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<ScannerUuid>();
 	case SQL_TYPE_DATE:
-		TypeSpecific::FetchAndSetResult<duckdb_date_struct>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<duckdb_date_struct>();
 	case SQL_TYPE_TIME:
 	case Types::SQL_SS_TIME2:
-		TypeSpecific::FetchAndSetResult<duckdb_time_struct>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<duckdb_time_struct>();
 	case SQL_TYPE_TIMESTAMP:
 	case SQL_SS_TIMESTAMPOFFSET:
-		TypeSpecific::FetchAndSetResult<duckdb_timestamp_struct>(ctx, odbc_type, col_idx, vec, row_idx);
-		break;
+		return TypeSpecific::CreateFetchKernel<duckdb_timestamp_struct>();
 	default:
 		throw ScannerException("Unsupported ODBC fetch type: " + odbc_type.ToString() + ", query: '" + ctx.query +
 		                       "', column idx: " + std::to_string(col_idx));
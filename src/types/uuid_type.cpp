@@ -58,13 +58,8 @@ void TypeSpecific::BindColumn<ScannerUuid>(QueryContext &ctx, OdbcType &odbc_typ
 	if (!ctx.quirks.enable_columns_binding) {
 		return;
 	}
-	SQLGUID nguid;
-	ZeroSqlGuid(nguid);
-	ScannerValue nval(nguid);
-	ColumnBind nbind(std::move(nval));
-
 	ColumnBind &bind = ctx.BindForColumn(col_idx);
-	bind = std::move(nbind);
+	bind = ColumnBind::Create<SQLGUID>(SQL_C_GUID, ctx.rowset_size);
 	SQLGUID &fetched = bind.Value<SQLGUID>();
 	SQLLEN &ind = bind.Indicator();
 	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, SQL_C_GUID, &fetched, sizeof(fetched), &ind);
@@ -87,9 +82,10 @@ void TypeSpecific::FetchAndSetResult<ScannerUuid>(QueryContext &ctx, OdbcType &,
 
 	if (ctx.quirks.enable_columns_binding) {
 		ColumnBind &bind = ctx.BindForColumn(col_idx);
-		SQLGUID &bound = bind.Value<SQLGUID>();
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQLGUID &bound = bind.Value<SQLGUID>(bound_row_idx);
 		fetched_ptr = &bound;
-		ind = bind.ind;
+		ind = bind.Indicator(bound_row_idx);
 	} else {
 		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_GUID, &fetched_data,
 		                           static_cast<SQLLEN>(sizeof(fetched_data)), &ind);
@@ -131,6 +127,12 @@ void TypeSpecific::FetchAndSetResult<ScannerUuid>(QueryContext &ctx, OdbcType &,
 	data[row_idx] = num;
 }
 
+template <>
+void TypeSpecific::SetBoundRows<ScannerUuid>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                             ColumnBind &bind, duckdb_vector vec, idx_t rows_count) {
+	SetBoundRowsPerCell<ScannerUuid>(ctx, odbc_type, col_idx, bind, vec, rows_count);
+}
+
 template <>
 duckdb_type TypeSpecific::ResolveColumnType<ScannerUuid>(QueryContext &, ResultColumn &) {
 	return DUCKDB_TYPE_UUID;
@@ -2,6 +2,7 @@
 
 #include <cstring>
 
+#include "arena.hpp"
 #include "capi_pointers.hpp"
 #include "diagnostics.hpp"
 #include "scanner_exception.hpp"
@@ -82,22 +83,97 @@ void TypeSpecific::BindOdbcParam<std::string>(QueryContext &ctx, ScannerValue &p
 	}
 }
 
-static std::pair<std::string, bool> FetchTail(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<SQLWCHAR> &buf,
-                                              SQLLEN len_bytes) {
-	if (len_bytes % sizeof(SQLWCHAR) != 0) {
+duckdb_string_t &Types::GetInlineStringResult(duckdb_vector vec, idx_t row_idx) {
+	duckdb_string_t *data = reinterpret_cast<duckdb_string_t *>(duckdb_vector_get_data(vec));
+	duckdb_string_t &str = data[row_idx];
+	// unused inline bytes must be zeroed, DuckDB compares inlined strings by all 16 bytes
+	std::memset(&str, '\0', sizeof(duckdb_string_t));
+	return str;
+}
+
+void Types::SetStringValueToResult(duckdb_vector vec, idx_t row_idx, const char *data, size_t len) {
+	if (len <= STRING_INLINE_LENGTH) {
+		duckdb_string_t &str = GetInlineStringResult(vec, row_idx);
+		std::memcpy(str.value.inlined.inlined, data, len);
+		str.value.inlined.length = static_cast<uint32_t>(len);
+	} else {
+		duckdb_vector_assign_string_element_len(vec, row_idx, data, len);
+	}
+}
+
+// Characters fetched into the arena memory, not nul-terminated
+template <typename CHAR_TYPE>
+struct FetchedChars {
+	const CHAR_TYPE *data;
+	size_t length;
+
+	FetchedChars(const CHAR_TYPE *data_in, size_t length_in) : data(data_in), length(length_in) {
+	}
+};
+
+// Character columns are fetched either as UTF-16 and converted to UTF-8, or,
+// when the driver is known to return UTF-8 for SQL_C_CHAR, as UTF-8 directly
+// without the intermediate transcoding
+template <typename CHAR_TYPE>
+struct CharTraits;
+
+template <>
+struct CharTraits<SQLWCHAR> {
+	static const SQLSMALLINT CTYPE = SQL_C_WCHAR;
+	// bytes reserved in bound buffers for every character of the declared column length,
+	// characters outside of the BMP take two UTF-16 code units
+	static const SQLLEN BOUND_BYTES_PER_CHAR = 2 * sizeof(SQLWCHAR);
+
+	static void SetToResult(Arena &arena, FetchedChars<SQLWCHAR> chars, duckdb_vector vec, idx_t row_idx) {
+		size_t capacity = chars.length * WideChar::MAX_UTF8_BYTES_PER_UNIT;
+
+		// short strings are transcoded directly into the vector inline storage
+		if (capacity <= Types::STRING_INLINE_LENGTH) {
+			duckdb_string_t &str = Types::GetInlineStringResult(vec, row_idx);
+			size_t out_len = WideChar::NarrowTo(chars.data, chars.length, str.value.inlined.inlined);
+			str.value.inlined.length = static_cast<uint32_t>(out_len);
+			return;
+		}
+
+		char *out = arena.Allocate<char>(capacity);
+		size_t out_len = WideChar::NarrowTo(chars.data, chars.length, out);
+		Types::SetStringValueToResult(vec, row_idx, out, out_len);
+	}
+};
+
+template <>
+struct CharTraits<char> {
+	static const SQLSMALLINT CTYPE = SQL_C_CHAR;
+	static const SQLLEN BOUND_BYTES_PER_CHAR = 4;
+
+	static void SetToResult(Arena &arena, FetchedChars<char> chars, duckdb_vector vec, idx_t row_idx) {
+		if (WideChar::FindInvalidUtf8(chars.data, chars.length) == nullptr) {
+			Types::SetStringValueToResult(vec, row_idx, chars.data, chars.length);
+			return;
+		}
+		char *out = arena.Allocate<char>(chars.length * WideChar::MAX_UTF8_BYTES_PER_UNIT);
+		size_t out_len = WideChar::ReplaceInvalidUtf8To(chars.data, chars.length, out);
+		Types::SetStringValueToResult(vec, row_idx, out, out_len);
+	}
+};
+
+template <typename CHAR_TYPE>
+static std::pair<FetchedChars<CHAR_TYPE>, bool> FetchTail(QueryContext &ctx, SQLSMALLINT col_idx,
+                                                          ArenaBuffer<CHAR_TYPE> &buf, SQLLEN len_bytes) {
+	if (len_bytes % sizeof(CHAR_TYPE) != 0) {
 		len_bytes -= 1;
 	}
-	size_t len = static_cast<size_t>(len_bytes / sizeof(SQLWCHAR));
+	size_t len = static_cast<size_t>(len_bytes / sizeof(CHAR_TYPE));
 
 	size_t head_size = buf.size() - 1;
 	buf.resize(len + 1);
 
-	SQLWCHAR *buf_tail_ptr = buf.data() + head_size;
+	CHAR_TYPE *buf_tail_ptr = buf.data() + head_size;
 	size_t buf_tail_size = buf.size() - head_size;
 	SQLLEN len_tail_bytes = 0;
 
-	SQLRETURN ret_tail = SQLGetData(ctx.hstmt(), col_idx, SQL_C_WCHAR, buf_tail_ptr,
-	                                static_cast<SQLLEN>(buf_tail_size * sizeof(SQLWCHAR)), &len_tail_bytes);
+	SQLRETURN ret_tail = SQLGetData(ctx.hstmt(), col_idx, CharTraits<CHAR_TYPE>::CTYPE, buf_tail_ptr,
+	                                static_cast<SQLLEN>(buf_tail_size * sizeof(CHAR_TYPE)), &len_tail_bytes);
 	if (!SQL_SUCCEEDED(ret_tail)) {
 		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
 		throw ScannerException("'SQLGetData' tail for VARCHAR failed, column index: " + std::to_string(col_idx) +
@@ -105,10 +181,10 @@ static std::pair<std::string, bool> FetchTail(QueryContext &ctx, SQLSMALLINT col
 		                       ", diagnostics: '" + diag + "'");
 	}
 
-	if (len_tail_bytes % sizeof(SQLWCHAR) != 0) {
+	if (len_tail_bytes % sizeof(CHAR_TYPE) != 0) {
 		len_tail_bytes -= 1;
 	}
-	size_t len_tail = static_cast<size_t>(len_tail_bytes / sizeof(SQLWCHAR));
+	size_t len_tail = static_cast<size_t>(len_tail_bytes / sizeof(CHAR_TYPE));
 	size_t len_tail_expected = len - head_size;
 	if (len_tail != len_tail_expected) {
 		throw ScannerException(
@@ -118,22 +194,23 @@ static std::pair<std::string, bool> FetchTail(QueryContext &ctx, SQLSMALLINT col
 		    ", head length: " + std::to_string(len_tail_expected) + ", actual: " + std::to_string(len_tail));
 	}
 
-	std::string str = WideChar::Narrow(buf.data(), buf.size() - 1);
-	return std::make_pair(std::move(str), false);
+	FetchedChars<CHAR_TYPE> chars(buf.data(), buf.size() - 1);
+	return std::make_pair(chars, false);
 }
 
-static std::pair<std::string, bool> FetchMultiReads(QueryContext &ctx, SQLSMALLINT col_idx,
-                                                    std::vector<SQLWCHAR> &buf) {
+template <typename CHAR_TYPE>
+static std::pair<FetchedChars<CHAR_TYPE>, bool> FetchMultiReads(QueryContext &ctx, SQLSMALLINT col_idx,
+                                                                ArenaBuffer<CHAR_TYPE> &buf) {
 	for (size_t i = 1; true; i++) {
 		size_t prev_len = buf.size();
 		size_t prev_written = prev_len - 1;
 		buf.resize(prev_len * 2);
 		SQLLEN len_bytes = 0;
 
-		SQLWCHAR *buf_ptr = buf.data() + prev_written;
+		CHAR_TYPE *buf_ptr = buf.data() + prev_written;
 		size_t buf_size = buf.size() - prev_written;
-		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_WCHAR, buf_ptr,
-		                           static_cast<SQLLEN>(buf_size * sizeof(SQLWCHAR)), &len_bytes);
+		SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, CharTraits<CHAR_TYPE>::CTYPE, buf_ptr,
+		                           static_cast<SQLLEN>(buf_size * sizeof(CHAR_TYPE)), &len_bytes);
 
 		if (!SQL_SUCCEEDED(ret)) {
 			std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
@@ -149,28 +226,29 @@ static std::pair<std::string, bool> FetchMultiReads(QueryContext &ctx, SQLSMALLI
 		}
 
 		if (ret == SQL_SUCCESS || diag_code != trunc_diag_code) {
-			if (len_bytes % sizeof(SQLWCHAR) != 0) {
+			if (len_bytes % sizeof(CHAR_TYPE) != 0) {
 				len_bytes -= 1;
 			}
 
-			size_t buf_size_full = prev_written + (len_bytes / sizeof(SQLWCHAR));
-			std::string str = WideChar::Narrow(buf.data(), buf_size_full);
-			return std::make_pair(std::move(str), false);
+			size_t buf_size_full = prev_written + (len_bytes / sizeof(CHAR_TYPE));
+			FetchedChars<CHAR_TYPE> chars(buf.data(), buf_size_full);
+			return std::make_pair(chars, false);
 		}
 	}
 }
 
-static std::pair<std::string, bool> FetchSinglePart(QueryContext &ctx, SQLSMALLINT col_idx, std::vector<SQLWCHAR> &buf,
-                                                    SQLLEN len_bytes) {
-	if (len_bytes % sizeof(SQLWCHAR) != 0) {
+template <typename CHAR_TYPE>
+static std::pair<FetchedChars<CHAR_TYPE>, bool> FetchSinglePart(QueryContext &ctx, SQLSMALLINT col_idx,
+                                                                ArenaBuffer<CHAR_TYPE> &buf, SQLLEN len_bytes) {
+	if (len_bytes % sizeof(CHAR_TYPE) != 0) {
 		len_bytes -= 1;
 	}
-	size_t len = static_cast<size_t>(len_bytes / sizeof(SQLWCHAR));
+	size_t len = static_cast<size_t>(len_bytes / sizeof(CHAR_TYPE));
 	buf.resize(len + 1);
 	SQLLEN len_read_bytes = 0;
 
-	SQLRETURN ret_tail = SQLGetData(ctx.hstmt(), col_idx, SQL_C_WCHAR, buf.data(),
-	                                static_cast<SQLLEN>(buf.size() * sizeof(SQLWCHAR)), &len_read_bytes);
+	SQLRETURN ret_tail = SQLGetData(ctx.hstmt(), col_idx, CharTraits<CHAR_TYPE>::CTYPE, buf.data(),
+	                                static_cast<SQLLEN>(buf.size() * sizeof(CHAR_TYPE)), &len_read_bytes);
 	if (!SQL_SUCCEEDED(ret_tail)) {
 		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
 		throw ScannerException(
@@ -178,7 +256,7 @@ static std::pair<std::string, bool> FetchSinglePart(QueryContext &ctx, SQLSMALLI
 		    ", query: '" + ctx.query + "', return: " + std::to_string(ret_tail) + ", diagnostics: '" + diag + "'");
 	}
 
-	if (len_read_bytes % sizeof(SQLWCHAR) != 0) {
+	if (len_read_bytes % sizeof(CHAR_TYPE) != 0) {
 		len_read_bytes -= 1;
 	}
 	if (len_read_bytes != len_bytes) {
@@ -190,16 +268,17 @@ static std::pair<std::string, bool> FetchSinglePart(QueryContext &ctx, SQLSMALLI
 		    ", first read length: " + std::to_string(len_bytes) + ", actual: " + std::to_string(len_read_bytes));
 	}
 
-	std::string str = WideChar::Narrow(buf.data(), buf.size() - 1);
-	return std::make_pair(std::move(str), false);
+	FetchedChars<CHAR_TYPE> chars(buf.data(), buf.size() - 1);
+	return std::make_pair(chars, false);
 }
 
-static std::pair<std::string, bool> FetchInternal(QueryContext &ctx, SQLSMALLINT col_idx) {
-	std::vector<SQLWCHAR> buf;
-	buf.resize(4096);
+template <typename CHAR_TYPE>
+static std::pair<FetchedChars<CHAR_TYPE>, bool> FetchInternal(QueryContext &ctx, SQLSMALLINT col_idx) {
+	ArenaBuffer<CHAR_TYPE> buf(ctx.arena);
+	buf.resize(4096 * sizeof(SQLWCHAR) / sizeof(CHAR_TYPE));
 	SQLLEN len_bytes = 0;
-	SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, SQL_C_WCHAR, buf.data(),
-	                           static_cast<SQLLEN>(buf.size() * sizeof(SQLWCHAR)), &len_bytes);
+	SQLRETURN ret = SQLGetData(ctx.hstmt(), col_idx, CharTraits<CHAR_TYPE>::CTYPE, buf.data(),
+	                           static_cast<SQLLEN>(buf.size() * sizeof(CHAR_TYPE)), &len_bytes);
 
 	if (!SQL_SUCCEEDED(ret)) {
 		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
@@ -217,42 +296,141 @@ static std::pair<std::string, bool> FetchInternal(QueryContext &ctx, SQLSMALLINT
 	if (ret == SQL_SUCCESS || diag_code != trunc_diag_code) {
 
 		if (len_bytes == SQL_NULL_DATA) {
-			return std::make_pair("", true);
+			return std::make_pair(FetchedChars<CHAR_TYPE>(nullptr, 0), true);
 		}
 
-		if (len_bytes % sizeof(SQLWCHAR) != 0) {
+		if (len_bytes % sizeof(CHAR_TYPE) != 0) {
 			len_bytes -= 1;
 		}
 
-		size_t len = len_bytes / sizeof(SQLWCHAR);
-		std::string str = WideChar::Narrow(buf.data(), len);
-		return std::make_pair(std::move(str), false);
+		size_t len = len_bytes / sizeof(CHAR_TYPE);
+		FetchedChars<CHAR_TYPE> chars(buf.data(), len);
+		return std::make_pair(chars, false);
 	}
 
 	// invariant: ret = SQL_SUCCESS_WITH_INFO && diag_code == "01004"
 
 	if (ctx.quirks.var_len_data_single_part) {
-		return FetchSinglePart(ctx, col_idx, buf, len_bytes);
+		return FetchSinglePart<CHAR_TYPE>(ctx, col_idx, buf, len_bytes);
 	}
 
 	if (len_bytes != SQL_NO_TOTAL) {
-		return FetchTail(ctx, col_idx, buf, len_bytes);
+		return FetchTail<CHAR_TYPE>(ctx, col_idx, buf, len_bytes);
+	}
+
+	return FetchMultiReads<CHAR_TYPE>(ctx, col_idx, buf);
+}
+
+// Size of the bound buffer for a single value of the column, including the nul-terminator,
+// returns 0 when the column length is not known
+template <typename CHAR_TYPE>
+static SQLLEN BoundValueSize(OdbcType &odbc_type) {
+	SQLLEN len_bytes = odbc_type.desc_length * CharTraits<CHAR_TYPE>::BOUND_BYTES_PER_CHAR;
+	if (odbc_type.desc_octet_length > len_bytes) {
+		len_bytes = odbc_type.desc_octet_length;
+	}
+	if (len_bytes <= 0) {
+		return 0;
+	}
+	SQLLEN char_size = static_cast<SQLLEN>(sizeof(CHAR_TYPE));
+	SQLLEN len_chars = (len_bytes + char_size - 1) / char_size;
+	return (len_chars + 1) * char_size;
+}
+
+template <typename CHAR_TYPE>
+static void BindColumnInternal(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
+	SQLLEN value_size = BoundValueSize<CHAR_TYPE>(odbc_type);
+	if (value_size == 0 || value_size > static_cast<SQLLEN>(ctx.quirks.varchar_columns_bind_max_bytes)) {
+		return;
 	}
+	SQLSMALLINT ctype = CharTraits<CHAR_TYPE>::CTYPE;
+	ColumnBind &bind = ctx.BindForColumn(col_idx);
+	bind = ColumnBind::CreateVarLen(ctype, value_size, ctx.rowset_size);
+	SQLRETURN ret = SQLBindCol(ctx.hstmt(), col_idx, ctype, bind.values.data(), value_size, bind.inds.data());
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLBindCol' failed, C type: " + std::to_string(ctype) + ", column index: " +
+		                       std::to_string(col_idx) + ", column type: " + odbc_type.ToString() + ",  query: '" +
+		                       ctx.query + "', return: " + std::to_string(ret) + ", diagnostics: '" + diag + "'");
+	}
+}
+
+template <>
+void TypeSpecific::BindColumn<std::string>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx) {
+	// Character columns are only bound in block fetch mode, with single-row fetch
+	// SQLGetData does not need to be mixed with bound columns.
+	if (!ctx.quirks.enable_columns_binding || ctx.rowset_size <= 1) {
+		return;
+	}
+	if (ctx.quirks.varchar_columns_as_utf8_chars) {
+		BindColumnInternal<char>(ctx, odbc_type, col_idx);
+	} else {
+		BindColumnInternal<SQLWCHAR>(ctx, odbc_type, col_idx);
+	}
+}
+
+// Moves the cursor to the specified row of the fetched rowset, so the value
+// that did not fit into the bound buffer can be read with SQLGetData
+static void PositionOnRow(QueryContext &ctx, SQLSMALLINT col_idx, idx_t bound_row_idx) {
+	SQLSETPOSIROW row_num = static_cast<SQLSETPOSIROW>(bound_row_idx + 1);
+	SQLRETURN ret = SQLSetPos(ctx.hstmt(), row_num, SQL_POSITION, SQL_LOCK_NO_CHANGE);
+	if (!SQL_SUCCEEDED(ret)) {
+		std::string diag = Diagnostics::Read(ctx.hstmt(), SQL_HANDLE_STMT);
+		throw ScannerException("'SQLSetPos' failed for truncated VARCHAR value, row number: " +
+		                       std::to_string(row_num) + ", column index: " + std::to_string(col_idx) + ", query: '" +
+		                       ctx.query + "', return: " + std::to_string(ret) + ", diagnostics: '" + diag +
+		                       "', binding of VARCHAR columns can be disabled with 'varchar_columns_bind_max_bytes=0'");
+	}
+}
 
-	return FetchMultiReads(ctx, col_idx, buf);
+template <typename CHAR_TYPE>
+static void FetchAndSetInternal(QueryContext &ctx, SQLSMALLINT col_idx, duckdb_vector vec, idx_t row_idx) {
+	if (ctx.quirks.enable_columns_binding && ctx.BindForColumn(col_idx).IsBound()) {
+		ColumnBind &bind = ctx.BindForColumn(col_idx);
+		idx_t bound_row_idx = ctx.BoundRowIdx(row_idx);
+		SQLLEN ind = bind.Indicator(bound_row_idx);
+		if (ind == SQL_NULL_DATA) {
+			Types::SetNullValueToResult(vec, row_idx);
+			return;
+		}
+		SQLLEN capacity_bytes = bind.value_size - static_cast<SQLLEN>(sizeof(CHAR_TYPE));
+		if (ind >= 0 && ind <= capacity_bytes) {
+			size_t len = static_cast<size_t>(ind) / sizeof(CHAR_TYPE);
+			FetchedChars<CHAR_TYPE> chars(bind.SizedValue<CHAR_TYPE>(bound_row_idx), len);
+			CharTraits<CHAR_TYPE>::SetToResult(ctx.arena, chars, vec, row_idx);
+			return;
+		}
+		// value is truncated in the bound buffer, it is read again as a whole
+		PositionOnRow(ctx, col_idx, bound_row_idx);
+	}
+
+	auto fetched = FetchInternal<CHAR_TYPE>(ctx, col_idx);
+	if (fetched.second) {
+		Types::SetNullValueToResult(vec, row_idx);
+	} else {
+		CharTraits<CHAR_TYPE>::SetToResult(ctx.arena, fetched.first, vec, row_idx);
+	}
 }
 
 template <>
 void TypeSpecific::FetchAndSetResult<std::string>(QueryContext &ctx, OdbcType &, SQLSMALLINT col_idx, duckdb_vector vec,
                                                   idx_t row_idx) {
-	auto fetched = FetchInternal(ctx, col_idx);
+	// scratch buffers are only needed until the value is copied into the vector
+	Arena::Mark mark = ctx.arena.GetMark();
 
-	if (fetched.second) {
-		Types::SetNullValueToResult(vec, row_idx);
-		return;
+	if (ctx.quirks.varchar_columns_as_utf8_chars) {
+		FetchAndSetInternal<char>(ctx, col_idx, vec, row_idx);
+	} else {
+		FetchAndSetInternal<SQLWCHAR>(ctx, col_idx, vec, row_idx);
 	}
 
-	duckdb_vector_assign_string_element_len(vec, row_idx, fetched.first.c_str(), fetched.first.length());
+	ctx.arena.Rewind(mark);
+}
+
+template <>
+void TypeSpecific::SetBoundRows<std::string>(QueryContext &ctx, OdbcType &odbc_type, SQLSMALLINT col_idx,
+                                             ColumnBind &bind, duckdb_vector vec, idx_t rows_count) {
+	SetBoundRowsPerCell<std::string>(ctx, odbc_type, col_idx, bind, vec, rows_count);
 }
 
 template <>
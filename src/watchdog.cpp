@@ -0,0 +1,121 @@
+#include "watchdog.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace odbcscanner {
+
+namespace {
+
+struct WatchedStatement {
+	HSTMT hstmt;
+	std::chrono::steady_clock::time_point deadline;
+	bool expired = false;
+	// SQLCancel is being called on the statement, the timer waits for it before the statement can be freed
+	bool canceling = false;
+
+	WatchedStatement(HSTMT hstmt_in, std::chrono::steady_clock::time_point deadline_in)
+	    : hstmt(hstmt_in), deadline(deadline_in) {
+	}
+};
+
+// Shared between all the connections, the thread is started when the first statement
+// is watched. Like the connections registry, the state is not destroyed on process exit.
+struct Watchdog {
+	std::mutex mutex;
+	std::condition_variable cv;
+	// notified when the cancel calls are completed
+	std::condition_variable canceled_cv;
+	std::map<uint64_t, WatchedStatement> statements;
+	uint64_t last_id = 0;
+	bool started = false;
+
+	void Run() {
+		std::unique_lock<std::mutex> lock(mutex);
+		std::vector<HSTMT> expired_hstmts;
+		for (;;) {
+			auto now = std::chrono::steady_clock::now();
+			auto next_deadline = std::chrono::steady_clock::time_point::max();
+			for (auto &en : statements) {
+				WatchedStatement &st = en.second;
+				if (st.expired) {
+					continue;
+				}
+				if (st.deadline <= now) {
+					st.expired = true;
+					st.canceling = true;
+					expired_hstmts.push_back(st.hstmt);
+				} else if (st.deadline < next_deadline) {
+					next_deadline = st.deadline;
+				}
+			}
+			if (expired_hstmts.size() > 0) {
+				// SQLCancel may block in the driver, so it is called without holding the lock,
+				// timers of the expired statements wait for the cancel to be completed
+				// before their statements can be freed
+				lock.unlock();
+				for (HSTMT hstmt : expired_hstmts) {
+					SQLCancel(hstmt);
+				}
+				expired_hstmts.clear();
+				lock.lock();
+				for (auto &en : statements) {
+					en.second.canceling = false;
+				}
+				canceled_cv.notify_all();
+				continue;
+			}
+			if (next_deadline == std::chrono::steady_clock::time_point::max()) {
+				cv.wait(lock);
+			} else {
+				cv.wait_until(lock, next_deadline);
+			}
+		}
+	}
+};
+
+} // namespace
+
+static Watchdog &SharedWatchdog() {
+	static Watchdog *watchdog = new Watchdog();
+	return *watchdog;
+}
+
+WatchdogTimer::WatchdogTimer(HSTMT hstmt, uint32_t timeout_seconds_in)
+    : timeout_seconds(timeout_seconds_in),
+      deadline(std::chrono::steady_clock::now() + std::chrono::seconds(timeout_seconds_in)) {
+	Watchdog &wd = SharedWatchdog();
+	{
+		std::lock_guard<std::mutex> guard(wd.mutex);
+		wd.last_id += 1;
+		watch_id = wd.last_id;
+		wd.statements.emplace(watch_id, WatchedStatement(hstmt, deadline));
+		if (!wd.started) {
+			std::thread thread([&wd] { wd.Run(); });
+			thread.detach();
+			wd.started = true;
+		}
+	}
+	wd.cv.notify_all();
+}
+
+WatchdogTimer::~WatchdogTimer() noexcept {
+	Watchdog &wd = SharedWatchdog();
+	std::unique_lock<std::mutex> lock(wd.mutex);
+	auto it = wd.statements.find(watch_id);
+	if (it == wd.statements.end()) {
+		return;
+	}
+	wd.canceled_cv.wait(lock, [&it] { return !it->second.canceling; });
+	wd.statements.erase(it);
+}
+
+bool WatchdogTimer::Expired() {
+	return std::chrono::steady_clock::now() >= deadline;
+}
+
+} // namespace odbcscanner
@@ -1,112 +1,294 @@
 #include "widechar.hpp"
 
-#include <limits>
-
-#define UTF_CPP_CPLUSPLUS 199711L
-#include "utf8.h"
+#include <cstring>
 
 namespace odbcscanner {
 
+static_assert(sizeof(SQLWCHAR) == 2, "UTF-16 SQLWCHAR is expected");
+
 static const uint32_t invalid_char_replacement = 0xfffd;
 
-template <typename u16bit_iterator>
-static u16bit_iterator utf16_find_invalid(u16bit_iterator start, u16bit_iterator end) {
-	while (start != end) {
-		utf8::utfchar32_t cp = utf8::internal::mask16(*start++);
-		if (utf8::internal::is_lead_surrogate(cp)) { // Take care of surrogate pairs first
-			if (start != end) {
-				const utf8::utfchar32_t trail_surrogate = utf8::internal::mask16(*start++);
-				if (!utf8::internal::is_trail_surrogate(trail_surrogate)) {
-					return start - 1;
-				}
-			} else {
-				return start - 1;
-			}
-		} else if (utf8::internal::is_trail_surrogate(cp)) { // Lone trail surrogate
-			return start;
-		}
+// ASCII fast path: strings are checked a machine word at a time, these masks
+// select the high bit of every byte or of every UTF-16 code unit in a word
+
+static const uint64_t ascii_mask_utf8 = 0x8080808080808080ULL;
+static const uint64_t ascii_mask_utf16 = 0xff80ff80ff80ff80ULL;
+
+static bool IsLeadSurrogate(uint32_t cu) {
+	return cu >= 0xd800 && cu <= 0xdbff;
+}
+
+static bool IsTrailSurrogate(uint32_t cu) {
+	return cu >= 0xdc00 && cu <= 0xdfff;
+}
+
+static bool IsUtf8Trail(unsigned char c) {
+	return (c & 0xc0) == 0x80;
+}
+
+static char *AppendUtf8(char *out, uint32_t cp) {
+	if (cp < 0x80) {
+		*out++ = static_cast<char>(cp);
+	} else if (cp < 0x800) {
+		*out++ = static_cast<char>(0xc0 | (cp >> 6));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3f));
+	} else if (cp < 0x10000) {
+		*out++ = static_cast<char>(0xe0 | (cp >> 12));
+		*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3f));
+	} else {
+		*out++ = static_cast<char>(0xf0 | (cp >> 18));
+		*out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+		*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3f));
 	}
-	return end;
+	return out;
 }
 
-template <typename u16bit_iterator, typename output_iterator>
-static output_iterator utf16_replace_invalid(u16bit_iterator start, u16bit_iterator end, output_iterator out,
-                                             utf8::utfchar16_t replacement) {
-	while (start != end) {
-		uint16_t char1 = *start++;
-		utf8::utfchar32_t cp = utf8::internal::mask16(char1);
-		if (utf8::internal::is_lead_surrogate(cp)) { // Take care of surrogate pairs first
-			if (start != end) {
-				uint16_t char2 = *start++;
-				const utf8::utfchar32_t trail_surrogate = utf8::internal::mask16(char2);
-				if (utf8::internal::is_trail_surrogate(trail_surrogate)) {
-					*out++ = char1;
-					*out++ = char2;
-				} else {
-					*out++ = replacement;
-					*out++ = char2;
-				}
-			} else {
-				*out++ = replacement;
-			}
-		} else if (utf8::internal::is_trail_surrogate(cp)) { // Lone trail surrogate
-			*out++ = replacement;
-		} else {
-			*out++ = char1;
-		}
+static SQLWCHAR *AppendUtf16(SQLWCHAR *out, uint32_t cp) {
+	if (cp < 0x10000) {
+		*out++ = static_cast<SQLWCHAR>(cp);
+	} else {
+		cp -= 0x10000;
+		*out++ = static_cast<SQLWCHAR>(0xd800 + (cp >> 10));
+		*out++ = static_cast<SQLWCHAR>(0xdc00 + (cp & 0x3ff));
 	}
 	return out;
 }
 
+// Decodes a single UTF-8 sequence starting at 'pos', returns the number of bytes
+// consumed or 0 when the sequence is not valid
+static size_t DecodeUtf8(const unsigned char *pos, const unsigned char *end, uint32_t &cp) {
+	unsigned char lead = *pos;
+	size_t len = 0;
+	uint32_t min_cp = 0;
+	if (lead < 0x80) {
+		cp = lead;
+		return 1;
+	} else if (lead >= 0xc2 && lead <= 0xdf) {
+		len = 2;
+		cp = lead & 0x1f;
+		min_cp = 0x80;
+	} else if (lead >= 0xe0 && lead <= 0xef) {
+		len = 3;
+		cp = lead & 0x0f;
+		min_cp = 0x800;
+	} else if (lead >= 0xf0 && lead <= 0xf4) {
+		len = 4;
+		cp = lead & 0x07;
+		min_cp = 0x10000;
+	} else {
+		return 0;
+	}
+
+	if (static_cast<size_t>(end - pos) < len) {
+		return 0;
+	}
+	for (size_t i = 1; i < len; i++) {
+		if (!IsUtf8Trail(pos[i])) {
+			return 0;
+		}
+		cp = (cp << 6) | (pos[i] & 0x3f);
+	}
+	if (cp < min_cp || cp > 0x10ffff || IsLeadSurrogate(cp) || IsTrailSurrogate(cp)) {
+		return 0;
+	}
+	return len;
+}
+
+// Skips the invalid sequence, a single replacement character is emitted for
+// the started sequence with all its trailing bytes, and for every byte that
+// cannot start a sequence
+static const unsigned char *SkipInvalidUtf8(const unsigned char *pos, const unsigned char *end) {
+	unsigned char lead = *pos++;
+	if (IsUtf8Trail(lead) || lead >= 0xf8) {
+		return pos;
+	}
+	while (pos != end && IsUtf8Trail(*pos)) {
+		pos++;
+	}
+	return pos;
+}
+
 std::string WideChar::Narrow(const SQLWCHAR *in_buf, size_t in_buf_len, const SQLWCHAR **first_invalid_char) {
 	std::string res;
-	auto res_bi = std::back_inserter(res);
+	res.resize(in_buf_len * MAX_UTF8_BYTES_PER_UNIT);
+	size_t len = NarrowTo(in_buf, in_buf_len, &res[0], first_invalid_char);
+	res.resize(len);
+	return res;
+}
+
+size_t WideChar::NarrowTo(const SQLWCHAR *in_buf, size_t in_buf_len, char *out_buf,
+                          const SQLWCHAR **first_invalid_char) {
+	if (first_invalid_char != nullptr) {
+		*first_invalid_char = nullptr;
+	}
+
+	char *out = out_buf;
 
-	const SQLWCHAR *in_buf_end = in_buf + in_buf_len;
-	const SQLWCHAR *first_invalid_found = utf16_find_invalid(in_buf, in_buf_end);
+	const SQLWCHAR *pos = in_buf;
+	const SQLWCHAR *end = in_buf + in_buf_len;
 
-	if (first_invalid_found == in_buf_end) {
-		utf8::unchecked::utf16to8(in_buf, in_buf_end, res_bi);
-		if (first_invalid_char != nullptr) {
-			*first_invalid_char = nullptr;
+	while (pos != end) {
+		while (end - pos >= 4) {
+			uint64_t word = 0;
+			std::memcpy(&word, pos, sizeof(word));
+			if ((word & ascii_mask_utf16) != 0) {
+				break;
+			}
+			out[0] = static_cast<char>(pos[0]);
+			out[1] = static_cast<char>(pos[1]);
+			out[2] = static_cast<char>(pos[2]);
+			out[3] = static_cast<char>(pos[3]);
+			out += 4;
+			pos += 4;
 		}
-	} else {
-		std::vector<SQLWCHAR> replaced;
-		auto replaced_bi = std::back_inserter(replaced);
-		utf16_replace_invalid(in_buf, in_buf_end, replaced_bi, invalid_char_replacement);
-		utf8::unchecked::utf16to8(replaced.begin(), replaced.end(), res_bi);
-		if (first_invalid_char != nullptr) {
-			*first_invalid_char = first_invalid_found;
+		if (pos == end) {
+			break;
+		}
+
+		uint32_t cu = *pos;
+		if (cu < 0x80) {
+			*out++ = static_cast<char>(cu);
+			pos++;
+			continue;
+		}
+
+		uint32_t cp = cu;
+		const SQLWCHAR *invalid = nullptr;
+		if (IsLeadSurrogate(cu)) {
+			if (pos + 1 != end && IsTrailSurrogate(pos[1])) {
+				cp = 0x10000 + ((cu - 0xd800) << 10) + (pos[1] - 0xdc00);
+				pos++;
+			} else {
+				invalid = pos;
+			}
+		} else if (IsTrailSurrogate(cu)) {
+			invalid = pos;
 		}
+		pos++;
+
+		if (invalid != nullptr) {
+			cp = invalid_char_replacement;
+			if (first_invalid_char != nullptr && *first_invalid_char == nullptr) {
+				*first_invalid_char = invalid;
+			}
+		}
+		out = AppendUtf8(out, cp);
 	}
 
-	return res;
+	return static_cast<size_t>(out - out_buf);
 }
 
 WideString WideChar::Widen(const char *in_buf, size_t in_buf_len, const char **first_invalid_char) {
+	if (first_invalid_char != nullptr) {
+		*first_invalid_char = nullptr;
+	}
+
+	// UTF-16 data never has more code units than there are bytes in UTF-8 data
 	std::vector<SQLWCHAR> res;
-	auto res_bi = std::back_inserter(res);
+	res.resize(in_buf_len + 1);
+	SQLWCHAR *out = res.data();
 
-	const char *in_buf_end = in_buf + in_buf_len;
-	const char *first_invalid_found = utf8::find_invalid(in_buf, in_buf_end);
+	const unsigned char *pos = reinterpret_cast<const unsigned char *>(in_buf);
+	const unsigned char *end = pos + in_buf_len;
 
-	if (first_invalid_found == in_buf_end) {
-		utf8::unchecked::utf8to16(in_buf, in_buf_end, res_bi);
-		if (first_invalid_char != nullptr) {
-			*first_invalid_char = nullptr;
+	while (pos != end) {
+		while (end - pos >= 8) {
+			uint64_t word = 0;
+			std::memcpy(&word, pos, sizeof(word));
+			if ((word & ascii_mask_utf8) != 0) {
+				break;
+			}
+			for (size_t i = 0; i < 8; i++) {
+				out[i] = static_cast<SQLWCHAR>(pos[i]);
+			}
+			out += 8;
+			pos += 8;
 		}
-	} else {
-		std::vector<char> replaced;
-		auto replaced_bi = std::back_inserter(replaced);
-		utf8::replace_invalid(in_buf, in_buf_end, replaced_bi, invalid_char_replacement);
-		utf8::unchecked::utf8to16(replaced.begin(), replaced.end(), res_bi);
-		if (first_invalid_char != nullptr) {
-			*first_invalid_char = first_invalid_found;
+		if (pos == end) {
+			break;
+		}
+
+		uint32_t cp = 0;
+		size_t len = DecodeUtf8(pos, end, cp);
+		if (len > 0) {
+			pos += len;
+		} else {
+			if (first_invalid_char != nullptr && *first_invalid_char == nullptr) {
+				*first_invalid_char = reinterpret_cast<const char *>(pos);
+			}
+			cp = invalid_char_replacement;
+			pos = SkipInvalidUtf8(pos, end);
 		}
+		out = AppendUtf16(out, cp);
 	}
 
-	res.push_back(0);
+	*out++ = 0;
+	res.resize(static_cast<size_t>(out - res.data()));
 	return WideString(std::move(res));
 }
 
+const char *WideChar::FindInvalidUtf8(const char *in_buf, size_t in_buf_len) {
+	const unsigned char *pos = reinterpret_cast<const unsigned char *>(in_buf);
+	const unsigned char *end = pos + in_buf_len;
+
+	while (pos != end) {
+		if (end - pos >= 8) {
+			uint64_t word = 0;
+			std::memcpy(&word, pos, sizeof(word));
+			if ((word & ascii_mask_utf8) == 0) {
+				pos += 8;
+				continue;
+			}
+		}
+		uint32_t cp = 0;
+		size_t len = DecodeUtf8(pos, end, cp);
+		if (len == 0) {
+			return reinterpret_cast<const char *>(pos);
+		}
+		pos += len;
+	}
+
+	return nullptr;
+}
+
+size_t WideChar::ReplaceInvalidUtf8To(const char *in_buf, size_t in_buf_len, char *out_buf) {
+	const unsigned char *pos = reinterpret_cast<const unsigned char *>(in_buf);
+	const unsigned char *end = pos + in_buf_len;
+	char *out = out_buf;
+
+	while (pos != end) {
+		uint32_t cp = 0;
+		size_t len = DecodeUtf8(pos, end, cp);
+		if (len > 0) {
+			std::memcpy(out, pos, len);
+			out += len;
+			pos += len;
+		} else {
+			out = AppendUtf8(out, invalid_char_replacement);
+			pos = SkipInvalidUtf8(pos, end);
+		}
+	}
+
+	return static_cast<size_t>(out - out_buf);
+}
+
+std::string WideChar::ValidateUtf8(const char *in_buf, size_t in_buf_len, const char **first_invalid_char) {
+	const char *first_invalid_found = FindInvalidUtf8(in_buf, in_buf_len);
+	if (first_invalid_char != nullptr) {
+		*first_invalid_char = first_invalid_found;
+	}
+
+	if (first_invalid_found == nullptr) {
+		return std::string(in_buf, in_buf_len);
+	}
+
+	std::string res;
+	res.resize(in_buf_len * MAX_UTF8_BYTES_PER_UNIT);
+	size_t len = ReplaceInvalidUtf8To(in_buf, in_buf_len, &res[0]);
+	res.resize(len);
+	return res;
+}
+
 } // namespace odbcscanner